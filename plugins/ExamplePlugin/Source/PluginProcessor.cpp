@@ -94,6 +94,9 @@ void ExamplePluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPe
     // Initialize parameter smoothing
     gainSmoother.setSmoothingTime(0.05, sampleRate);  // 50ms smoothing time
     gainSmoother.snapToTarget();  // Initialize to current value
+    
+    // Smoothed gain for one block, rendered before it is applied
+    gainBuffer.assign(static_cast<size_t>(juce::jmax(1, samplesPerBlock)), 0.0f);
 }
 
 void ExamplePluginAudioProcessor::releaseResources()
@@ -141,22 +144,33 @@ void ExamplePluginAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
 
     // Use JUCE's AudioBlock for efficient processing
     auto block = juce::dsp::AudioBlock<float>(buffer);
-    auto context = juce::dsp::ProcessContextReplacing<float>(block);
     
-    // Process each sample with smoothed gain
-    for (int sample = 0; sample < numSamples; ++sample)
+    if (gainBuffer.empty())
+        return;  // Not prepared yet
+    
+    // Render the smoothed gain a chunk at a time; once it has settled the chunk takes a
+    // single scalar gain instead
+    const int maxChunkSize = static_cast<int>(gainBuffer.size());
+    auto* gains = gainBuffer.data();
+    
+    for (int offset = 0; offset < numSamples; offset += maxChunkSize)
     {
-        const float smoothedGain = gainSmoother.getNextValue();
+        const int chunkSize = juce::jmin(maxChunkSize, numSamples - offset);
+        auto chunk = block.getSubBlock(static_cast<size_t>(offset), static_cast<size_t>(chunkSize));
+        const bool isSmoothing = gainSmoother.fillBlock(gains, chunkSize);
         
-        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+        for (size_t channel = 0; channel < chunk.getNumChannels(); ++channel)
         {
-            float inputSample = block.getSample(channel, sample);
-            float outputSample = inputSample * smoothedGain;
+            auto* samples = chunk.getChannelPointer(channel);
             
-            // Denormal protection and sanitization
-            outputSample = TylerAudio::Utils::sanitizeFloat(outputSample);
+            if (isSmoothing)
+                juce::FloatVectorOperations::multiply(samples, gains, chunkSize);
+            else
+                juce::FloatVectorOperations::multiply(samples, gains[0], chunkSize);
             
-            block.setSample(channel, sample, outputSample);
+            // Denormal protection and sanitization
+            for (int sample = 0; sample < chunkSize; ++sample)
+                samples[sample] = TylerAudio::Utils::sanitizeFloat(samples[sample]);
         }
     }
 }
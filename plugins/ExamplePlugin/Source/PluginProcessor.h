@@ -2,6 +2,7 @@
 
 #include <JuceHeader.h>
 #include "TylerAudioCommon.h"
+#include <vector>
 
 class ExamplePluginAudioProcessor : public juce::AudioProcessor,
                                     public juce::AudioProcessorValueTreeState::Listener
@@ -52,6 +53,7 @@ private:
     
     // Parameter smoothing
     TylerAudio::Utils::SmoothingFilter gainSmoother;
+    std::vector<float> gainBuffer;
     
     // Create parameter layout
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+// Allocation-free biquad coefficient calculators. Each function writes a normalised
+// second-order section straight into caller-owned storage laid out as {b0, b1, b2, a1, a2}
+// (a0 == 1), the same layout juce::dsp::IIR::Coefficients uses. The formulas match the
+// juce::dsp::IIR::Coefficients::make* factories, which allocate a new object on every call
+// and therefore must not be used on the audio thread.
+namespace TylerAudio::TingeTape::BiquadDesign
+{
+    constexpr int kNumCoefficients = 5;
+
+    template <typename SampleType>
+    void setNormalised(SampleType* coefficients,
+                       SampleType b0, SampleType b1, SampleType b2,
+                       SampleType a0, SampleType a1, SampleType a2) noexcept
+    {
+        jassert(a0 != SampleType(0));
+        const auto a0Inverse = SampleType(1) / a0;
+
+        coefficients[0] = b0 * a0Inverse;
+        coefficients[1] = b1 * a0Inverse;
+        coefficients[2] = b2 * a0Inverse;
+        coefficients[3] = a1 * a0Inverse;
+        coefficients[4] = a2 * a0Inverse;
+    }
+
+    // Second-order high-pass with resonance q
+    template <typename SampleType>
+    void makeHighPass(SampleType* coefficients, double sampleRate, SampleType frequency, SampleType q) noexcept
+    {
+        jassert(sampleRate > 0.0 && frequency > 0 && frequency <= static_cast<SampleType>(sampleRate * 0.5) && q > 0);
+
+        const auto n = SampleType(1) / std::tan(juce::MathConstants<SampleType>::pi * frequency
+                                                / static_cast<SampleType>(sampleRate));
+        const auto nSquared = n * n;
+        const auto invQ = SampleType(1) / q;
+        const auto c1 = SampleType(1) / (SampleType(1) + invQ * n + nSquared);
+
+        setNormalised(coefficients,
+                      c1 * nSquared, SampleType(-2) * c1 * nSquared, c1 * nSquared,
+                      SampleType(1), c1 * SampleType(2) * (SampleType(1) - nSquared),
+                      c1 * (SampleType(1) - invQ * n + nSquared));
+    }
+
+    // Second-order low-pass with resonance q
+    template <typename SampleType>
+    void makeLowPass(SampleType* coefficients, double sampleRate, SampleType frequency, SampleType q) noexcept
+    {
+        jassert(sampleRate > 0.0 && frequency > 0 && frequency <= static_cast<SampleType>(sampleRate * 0.5) && q > 0);
+
+        const auto n = SampleType(1) / std::tan(juce::MathConstants<SampleType>::pi * frequency
+                                                / static_cast<SampleType>(sampleRate));
+        const auto nSquared = n * n;
+        const auto invQ = SampleType(1) / q;
+        const auto c1 = SampleType(1) / (SampleType(1) + invQ * n + nSquared);
+
+        setNormalised(coefficients,
+                      c1, c1 * SampleType(2), c1,
+                      SampleType(1), c1 * SampleType(2) * (SampleType(1) - nSquared),
+                      c1 * (SampleType(1) - invQ * n + nSquared));
+    }
+
+    // Low shelf; gainFactor is linear gain applied below cutOffFrequency
+    template <typename SampleType>
+    void makeLowShelf(SampleType* coefficients, double sampleRate, SampleType cutOffFrequency,
+                      SampleType q, SampleType gainFactor) noexcept
+    {
+        jassert(sampleRate > 0.0 && cutOffFrequency > 0 && q > 0);
+
+        const auto A = juce::jmax(SampleType(0), std::sqrt(gainFactor));
+        const auto aminus1 = A - SampleType(1);
+        const auto aplus1 = A + SampleType(1);
+        const auto omega = (SampleType(2) * juce::MathConstants<SampleType>::pi * juce::jmax(cutOffFrequency, SampleType(2)))
+                           / static_cast<SampleType>(sampleRate);
+        const auto coso = std::cos(omega);
+        const auto beta = std::sin(omega) * std::sqrt(A) / q;
+        const auto aminus1TimesCoso = aminus1 * coso;
+
+        setNormalised(coefficients,
+                      A * (aplus1 - aminus1TimesCoso + beta),
+                      A * SampleType(2) * (aminus1 - aplus1 * coso),
+                      A * (aplus1 - aminus1TimesCoso - beta),
+                      aplus1 + aminus1TimesCoso + beta,
+                      SampleType(-2) * (aminus1 + aplus1 * coso),
+                      aplus1 + aminus1TimesCoso - beta);
+    }
+
+    // High shelf; gainFactor is linear gain applied above cutOffFrequency
+    template <typename SampleType>
+    void makeHighShelf(SampleType* coefficients, double sampleRate, SampleType cutOffFrequency,
+                       SampleType q, SampleType gainFactor) noexcept
+    {
+        jassert(sampleRate > 0.0 && cutOffFrequency > 0 && q > 0);
+
+        const auto A = juce::jmax(SampleType(0), std::sqrt(gainFactor));
+        const auto aminus1 = A - SampleType(1);
+        const auto aplus1 = A + SampleType(1);
+        const auto omega = (SampleType(2) * juce::MathConstants<SampleType>::pi * juce::jmax(cutOffFrequency, SampleType(2)))
+                           / static_cast<SampleType>(sampleRate);
+        const auto coso = std::cos(omega);
+        const auto beta = std::sin(omega) * std::sqrt(A) / q;
+        const auto aminus1TimesCoso = aminus1 * coso;
+
+        setNormalised(coefficients,
+                      A * (aplus1 + aminus1TimesCoso + beta),
+                      A * SampleType(-2) * (aminus1 + aplus1 * coso),
+                      A * (aplus1 + aminus1TimesCoso - beta),
+                      aplus1 - aminus1TimesCoso + beta,
+                      SampleType(2) * (aminus1 - aplus1 * coso),
+                      aplus1 - aminus1TimesCoso - beta);
+    }
+
+    // Steeper filters cascade up to kMaxCascadeSections second-order sections, 12 dB/oct each
+    constexpr int kMaxCascadeSections = 4;
+
+    // Q of one section of a Butterworth response built from numSections sections, lowest
+    // first. Tabulated so choosing them needs no trig on the audio thread.
+    [[nodiscard]] inline double butterworthSectionQ(int numSections, int section) noexcept
+    {
+        static constexpr double kQ[kMaxCascadeSections][kMaxCascadeSections] = {
+            {0.70710678},                                 // 1 / (2 cos((2k + 1) pi / 4n))
+            {0.54119610, 1.30656296},
+            {0.51763809, 0.70710678, 1.93185165},
+            {0.50979558, 0.60134489, 0.89997622, 2.56291545}
+        };
+
+        jassert(numSections > 0 && numSections <= kMaxCascadeSections && section >= 0 && section < numSections);
+        return kQ[juce::jlimit(1, kMaxCascadeSections, numSections) - 1][juce::jlimit(0, kMaxCascadeSections - 1, section)];
+    }
+
+    // Q of one section of a resonant cascade: Butterworth, with the last (highest-Q) section
+    // scaled by resonance so 0.707 is maximally flat at every slope and higher settings
+    // peak at the cutoff. A single section takes the resonance as its Q.
+    [[nodiscard]] inline double resonantSectionQ(int numSections, int section, double resonance) noexcept
+    {
+        const auto q = butterworthSectionQ(numSections, section);
+        return section == numSections - 1 ? q * resonance / butterworthSectionQ(1, 0) : q;
+    }
+
+    // Time for a second-order section's impulse response to decay by decayDb, set by its
+    // slowest pole. Below q = 0.5 the poles are real and the slower one dominates.
+    [[nodiscard]] inline double decayTimeSeconds(double frequency, double q, double decayDb) noexcept
+    {
+        jassert(frequency > 0.0 && q > 0.0);
+
+        const auto omega = juce::MathConstants<double>::twoPi * frequency;
+        const auto damping = 1.0 / (2.0 * q);
+        const auto decayRate = omega * (damping - std::sqrt(juce::jmax(0.0, damping * damping - 1.0)));
+        return decayDb / 20.0 * std::log(10.0) / decayRate;
+    }
+}
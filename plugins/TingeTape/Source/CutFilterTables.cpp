@@ -0,0 +1,69 @@
+#include "CutFilterTables.h"
+#include <algorithm>
+
+namespace TylerAudio::TingeTape
+{
+// =============================================================================
+// Cut Filter Table Implementation
+// =============================================================================
+
+CutFilterTable::CutFilterTable(double sampleRate, Response response, double minFrequency, double maxFrequency)
+{
+    jassert(sampleRate > 0.0 && minFrequency > 0.0 && maxFrequency > minFrequency);
+
+    // At very low sample rates the range slides down below Nyquist rather than collapsing
+    const auto maxDesignFrequency = juce::jmin(maxFrequency, sampleRate * 0.49);
+    const auto minDesignFrequency = juce::jmin(minFrequency, maxDesignFrequency * 0.5);
+
+    log2MinFrequency = std::log2(minDesignFrequency);
+    frequencyScale = (kNumFrequencyPoints - 1) / (std::log2(maxDesignFrequency) - log2MinFrequency);
+    log2MinQ = std::log2(kMinQ);
+    qScale = (kNumQPoints - 1) / (std::log2(kMaxQ) - log2MinQ);
+
+    // Built with the exact designs: this runs off the audio thread, so the trig is free
+    points.resize(static_cast<size_t>(kNumFrequencyPoints * kNumQPoints));
+
+    for (int f = 0; f < kNumFrequencyPoints; ++f)
+    {
+        const auto frequency = std::exp2(log2MinFrequency + f / frequencyScale);
+
+        for (int q = 0; q < kNumQPoints; ++q)
+        {
+            auto* coefficients = points[static_cast<size_t>(f * kNumQPoints + q)].data();
+            const auto resonance = std::exp2(log2MinQ + q / qScale);
+
+            if (response == Response::highPass)
+                BiquadDesign::makeHighPass(coefficients, sampleRate, frequency, resonance);
+            else
+                BiquadDesign::makeLowPass(coefficients, sampleRate, frequency, resonance);
+        }
+    }
+}
+
+CutFilterTables::CutFilterTables(double rate)
+    : sampleRate(rate),
+      lowCut(rate, CutFilterTable::Response::highPass, 20.0, 200.0),
+      highCut(rate, CutFilterTable::Response::lowPass, 5000.0, 20000.0)
+{
+}
+
+// =============================================================================
+// Cut Filter Table Cache Implementation
+// =============================================================================
+
+std::shared_ptr<const CutFilterTables> CutFilterTableCache::getTables(double sampleRate)
+{
+    const juce::ScopedLock scopedLock(lock);
+
+    tables.erase(std::remove_if(tables.begin(), tables.end(), [](const auto& entry) { return entry.expired(); }),
+                 tables.end());
+
+    for (const auto& entry : tables)
+        if (auto shared = entry.lock(); shared != nullptr && shared->sampleRate == sampleRate)
+            return shared;
+
+    auto shared = std::make_shared<const CutFilterTables>(sampleRate);
+    tables.push_back(shared);
+    return shared;
+}
+}
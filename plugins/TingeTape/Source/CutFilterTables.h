@@ -0,0 +1,130 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "BiquadDesign.h"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace TylerAudio::TingeTape
+{
+    // Biquad coefficients for one resonant cut filter at one sample rate, precomputed over
+    // its whole parameter range on a grid evenly spaced in log frequency and log Q and read
+    // back with bilinear interpolation, so automation costs a few multiplies instead of a
+    // tan(). The Q range covers every section of the steeper slopes, whose last section
+    // reaches 7.3 at full resonance. The coefficients are stored in double: near 20 Hz at
+    // high sample rates the poles sit too close to the unit circle for float to
+    // interpolate them. The magnitude response stays within 0.1 dB of the exact design
+    // across the grid.
+    class CutFilterTable
+    {
+    public:
+        static constexpr int kNumFrequencyPoints = 96;
+        static constexpr int kNumQPoints = 48;
+        static constexpr double kMinQ = 0.1;
+        static constexpr double kMaxQ = 8.0;
+
+        enum class Response
+        {
+            highPass,
+            lowPass
+        };
+
+        // The frequency range is clamped below 0.49 of the sample rate
+        CutFilterTable(double sampleRate, Response response, double minFrequency, double maxFrequency);
+
+        // Writes {b0, b1, b2, a1, a2} for the nearest point inside the table's range
+        template <typename SampleType>
+        void lookup(SampleType* coefficients, double frequency, double q) const noexcept
+        {
+            const auto frequencyPosition = toPosition((fastLog2(frequency) - log2MinFrequency) * frequencyScale,
+                                                      kNumFrequencyPoints);
+            const auto qPosition = toPosition((fastLog2(q) - log2MinQ) * qScale, kNumQPoints);
+
+            const auto frequencyIndex = juce::jmin(static_cast<int>(frequencyPosition), kNumFrequencyPoints - 2);
+            const auto qIndex = juce::jmin(static_cast<int>(qPosition), kNumQPoints - 2);
+            const auto frequencyFraction = frequencyPosition - frequencyIndex;
+            const auto qFraction = qPosition - qIndex;
+
+            const auto& c00 = getPoint(frequencyIndex, qIndex);
+            const auto& c01 = getPoint(frequencyIndex, qIndex + 1);
+            const auto& c10 = getPoint(frequencyIndex + 1, qIndex);
+            const auto& c11 = getPoint(frequencyIndex + 1, qIndex + 1);
+
+            for (size_t i = 0; i < static_cast<size_t>(BiquadDesign::kNumCoefficients); ++i)
+            {
+                const auto low = c00[i] + qFraction * (c01[i] - c00[i]);
+                const auto high = c10[i] + qFraction * (c11[i] - c10[i]);
+                coefficients[i] = static_cast<SampleType>(low + frequencyFraction * (high - low));
+            }
+        }
+
+    private:
+        using Point = std::array<double, BiquadDesign::kNumCoefficients>;
+
+        // log2 of a positive value to within 1.2e-4: the exponent from the bits plus a quartic
+        // in the mantissa, exact at powers of two so it stays monotonic. That places a lookup
+        // within 0.01% of its frequency, at a fraction of the cost of std::log2.
+        [[nodiscard]] static double fastLog2(double x) noexcept
+        {
+            constexpr std::uint64_t kExponentMask = 0x7ff0000000000000ull;
+            constexpr std::uint64_t kMantissaMask = 0x000fffffffffffffull;
+            constexpr std::uint64_t kExponentOfOne = 0x3ff0000000000000ull;
+
+            const auto bits = std::bit_cast<std::uint64_t>(x);
+            const auto exponent = static_cast<int>((bits & kExponentMask) >> 52) - 1023;
+            const auto m = std::bit_cast<double>((bits & kMantissaMask) | kExponentOfOne) - 1.0;
+
+            return exponent + m * (1.438723467 + m * (-0.677771309 + m * (0.321168624 + m * -0.082120782)));
+        }
+
+        // Clamps a grid position to the table; written so a NaN lands on the first point
+        [[nodiscard]] static double toPosition(double position, int numPoints) noexcept
+        {
+            const auto last = static_cast<double>(numPoints - 1);
+            return position > 0.0 ? (position < last ? position : last) : 0.0;
+        }
+
+        [[nodiscard]] const Point& getPoint(int frequencyIndex, int qIndex) const noexcept
+        {
+            return points[static_cast<size_t>(frequencyIndex * kNumQPoints + qIndex)];
+        }
+
+        std::vector<Point> points;
+        double log2MinFrequency{0.0};
+        double frequencyScale{0.0};
+        double log2MinQ{0.0};
+        double qScale{0.0};
+    };
+
+    // Tables for both cut filters over their parameter ranges at one sample rate
+    struct CutFilterTables
+    {
+        explicit CutFilterTables(double sampleRate);
+
+        double sampleRate;
+        CutFilterTable lowCut;   // 20-200 Hz high-pass
+        CutFilterTable highCut;  // 5-20 kHz low-pass
+    };
+
+    // Process-wide store of CutFilterTables shared by every TingeTape instance. The first
+    // instance prepared at a sample rate builds its tables; later ones share them, and they
+    // are freed once no instance holds them. Obtain it through a juce::SharedResourcePointer.
+    class CutFilterTableCache
+    {
+    public:
+        CutFilterTableCache() = default;
+
+        // Not realtime safe: may build the tables
+        [[nodiscard]] std::shared_ptr<const CutFilterTables> getTables(double sampleRate);
+
+    private:
+        juce::CriticalSection lock;
+        std::vector<std::weak_ptr<const CutFilterTables>> tables;
+
+        JUCE_DECLARE_NON_COPYABLE(CutFilterTableCache)
+    };
+}
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <vector>
+
+namespace TylerAudio::TingeTape
+{
+    enum class DelayInterpolation
+    {
+        linear,        // 2 taps
+        cubicHermite,  // 4 taps, Catmull-Rom spline
+        lagrange3rd,   // 4 taps, 3rd order Lagrange polynomial
+        allpass        // 2 taps, 1st order Thiran allpass (recursive, flat magnitude)
+    };
+
+    // Multichannel delay line for modulated delays. All channels share one power-of-two
+    // ring of interleaved sample frames addressed by masking, so the taps of every channel
+    // for a given delay sit next to each other in memory. Blocks are handled in chunks that
+    // are written in one go and then read back against a per-sample delay curve shared by
+    // all channels; the curve is split into integer read positions and fractions once per
+    // chunk, so every channel only gathers and interpolates. The chunk length is fixed, so
+    // the ring only has to reach the longest delay and does not grow with the host block
+    // size. Nothing allocates after prepare().
+    template <typename SampleType>
+    class ModulatedDelay
+    {
+    public:
+        // Delays are in samples and must lie in [1, maxDelaySamples]
+        void prepare(int maxDelaySamples, int maxBlockSize, int numChannels)
+        {
+            this->numChannels = juce::jmax(1, numChannels);
+
+            // Room for the longest delay plus the interpolators' extra taps behind a chunk
+            chunkSize = juce::jlimit(1, kMaxChunkSize, maxBlockSize);
+            bufferFrames = juce::nextPowerOfTwo(juce::jmax(1, maxDelaySamples) + kMaxExtraTaps + chunkSize);
+            mask = bufferFrames - 1;
+
+            buffer.assign(static_cast<size_t>(bufferFrames * this->numChannels), SampleType(0));
+            allpassState.assign(static_cast<size_t>(this->numChannels), SampleType(0));
+            readIndices.assign(static_cast<size_t>(chunkSize), 0);
+            fractions.assign(static_cast<size_t>(chunkSize), SampleType(0));
+
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            std::fill(buffer.begin(), buffer.end(), SampleType(0));
+            std::fill(allpassState.begin(), allpassState.end(), SampleType(0));
+            writePosition = 0;
+        }
+
+        void setInterpolation(DelayInterpolation newInterpolation) noexcept { interpolation = newInterpolation; }
+        [[nodiscard]] DelayInterpolation getInterpolation() const noexcept { return interpolation; }
+
+        // Heap memory held by this delay line, in bytes
+        [[nodiscard]] size_t getMemoryUsageBytes() const noexcept
+        {
+            return buffer.capacity() * sizeof(SampleType)
+                 + allpassState.capacity() * sizeof(SampleType)
+                 + readIndices.capacity() * sizeof(int)
+                 + fractions.capacity() * sizeof(SampleType);
+        }
+
+        // Replaces the block with its delayed copy
+        void process(juce::dsp::AudioBlock<SampleType>& block, const float* delaySamples) noexcept
+        {
+            const auto numSamples = static_cast<int>(block.getNumSamples());
+
+            for (int start = 0; start < numSamples; start += chunkSize)
+            {
+                const auto length = juce::jmin(chunkSize, numSamples - start);
+                auto chunk = block.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(length));
+
+                write(chunk);
+
+                switch (interpolation)
+                {
+                    case DelayInterpolation::linear:       read<DelayInterpolation::linear>(chunk, delaySamples + start); break;
+                    case DelayInterpolation::cubicHermite: read<DelayInterpolation::cubicHermite>(chunk, delaySamples + start); break;
+                    case DelayInterpolation::lagrange3rd:  read<DelayInterpolation::lagrange3rd>(chunk, delaySamples + start); break;
+                    case DelayInterpolation::allpass:      read<DelayInterpolation::allpass>(chunk, delaySamples + start); break;
+                }
+
+                writePosition = (writePosition + length) & mask;
+            }
+        }
+
+        // Stores the block without reading, keeping the history current while bypassed
+        void push(const juce::dsp::AudioBlock<SampleType>& block) noexcept
+        {
+            const auto numSamples = static_cast<int>(block.getNumSamples());
+
+            for (int start = 0; start < numSamples; start += chunkSize)
+            {
+                const auto length = juce::jmin(chunkSize, numSamples - start);
+                write(block.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(length)));
+                writePosition = (writePosition + length) & mask;
+            }
+        }
+
+    private:
+        static constexpr int kMaxExtraTaps = 2;    // Taps older than the integer delay
+        static constexpr int kMaxChunkSize = 256;  // Frames written and read per pass
+
+        void write(const juce::dsp::AudioBlock<SampleType>& block) noexcept
+        {
+            const auto numSamples = static_cast<int>(block.getNumSamples());
+            const auto channelsToWrite = juce::jmin(numChannels, static_cast<int>(block.getNumChannels()));
+
+            for (int channel = 0; channel < channelsToWrite; ++channel)
+            {
+                const auto* source = block.getChannelPointer(static_cast<size_t>(channel));
+                auto* ring = buffer.data() + channel;
+
+                for (int i = 0; i < numSamples; ++i)
+                    ring[((writePosition + i) & mask) * numChannels] = source[i];
+            }
+        }
+
+        // Splits the delay curve into the ring index of the integer delay tap and the
+        // fraction towards the next older one. The chunk is written before it is read, so
+        // taps up to the current sample are valid: the 4-tap interpolators look one sample
+        // newer than the integer delay, which the minimum delay of 1 allows. Frames are then
+        // read one at a time across all channels, so each tap is a single contiguous fetch.
+        template <DelayInterpolation Interpolation>
+        void read(juce::dsp::AudioBlock<SampleType>& block, const float* delaySamples) noexcept
+        {
+            const auto numSamples = static_cast<int>(block.getNumSamples());
+            const auto channelsToRead = static_cast<size_t>(juce::jmin(numChannels, static_cast<int>(block.getNumChannels())));
+            auto* indices = readIndices.data();
+            auto* fracs = fractions.data();
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                jassert(delaySamples[i] >= 1.0f);
+                auto delay = static_cast<SampleType>(delaySamples[i]);
+                auto integerDelay = static_cast<int>(delay);
+                auto fraction = delay - static_cast<SampleType>(integerDelay);
+
+                // Thiran is best conditioned with the fraction in [0.618, 1.618)
+                if constexpr (Interpolation == DelayInterpolation::allpass)
+                {
+                    if (fraction < SampleType(0.618) && integerDelay >= 1)
+                    {
+                        fraction += SampleType(1);
+                        --integerDelay;
+                    }
+                }
+
+                indices[i] = writePosition + i - integerDelay;
+                fracs[i] = fraction;
+            }
+
+            const auto frame = [this](int index) { return buffer.data() + (index & mask) * numChannels; };
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const auto t = fracs[i];
+                const auto* frame0 = frame(indices[i]);
+                const auto* frame1 = frame(indices[i] - 1);
+
+                if constexpr (Interpolation == DelayInterpolation::linear)
+                {
+                    for (size_t channel = 0; channel < channelsToRead; ++channel)
+                        block.getChannelPointer(channel)[i] = frame0[channel] + t * (frame1[channel] - frame0[channel]);
+                }
+                else if constexpr (Interpolation == DelayInterpolation::cubicHermite)
+                {
+                    const auto* frameNewer = frame(indices[i] + 1);
+                    const auto* frame2 = frame(indices[i] - 2);
+
+                    for (size_t channel = 0; channel < channelsToRead; ++channel)
+                    {
+                        const auto yNewer = frameNewer[channel];
+                        const auto y0 = frame0[channel];
+                        const auto y1 = frame1[channel];
+                        const auto y2 = frame2[channel];
+
+                        const auto c1 = SampleType(0.5) * (y1 - yNewer);
+                        const auto c2 = yNewer - SampleType(2.5) * y0 + SampleType(2) * y1 - SampleType(0.5) * y2;
+                        const auto c3 = SampleType(0.5) * (y2 - yNewer) + SampleType(1.5) * (y0 - y1);
+                        block.getChannelPointer(channel)[i] = ((c3 * t + c2) * t + c1) * t + y0;
+                    }
+                }
+                else if constexpr (Interpolation == DelayInterpolation::lagrange3rd)
+                {
+                    const auto* frameNewer = frame(indices[i] + 1);
+                    const auto* frame2 = frame(indices[i] - 2);
+
+                    // Nodes at -1, 0, 1, 2 samples relative to the integer delay
+                    const auto tPlus1 = t + SampleType(1);
+                    const auto tMinus1 = t - SampleType(1);
+                    const auto tMinus2 = t - SampleType(2);
+                    const auto wNewer = -t * tMinus1 * tMinus2 / SampleType(6);
+                    const auto w0 = tPlus1 * tMinus1 * tMinus2 / SampleType(2);
+                    const auto w1 = -tPlus1 * t * tMinus2 / SampleType(2);
+                    const auto w2 = tPlus1 * t * tMinus1 / SampleType(6);
+
+                    for (size_t channel = 0; channel < channelsToRead; ++channel)
+                    {
+                        block.getChannelPointer(channel)[i] = wNewer * frameNewer[channel] + w0 * frame0[channel]
+                                                            + w1 * frame1[channel] + w2 * frame2[channel];
+                    }
+                }
+                else
+                {
+                    const auto alpha = (SampleType(1) - t) / (SampleType(1) + t);
+
+                    for (size_t channel = 0; channel < channelsToRead; ++channel)
+                    {
+                        auto& state = allpassState[channel];
+                        state = frame1[channel] + alpha * (frame0[channel] - state);
+                        block.getChannelPointer(channel)[i] = state;
+                    }
+                }
+            }
+        }
+
+        std::vector<SampleType> buffer;        // bufferFrames frames of numChannels interleaved samples
+        std::vector<SampleType> allpassState;  // Last allpass output per channel
+        std::vector<int> readIndices;          // Per-sample ring frame of the integer delay tap
+        std::vector<SampleType> fractions;     // Per-sample fraction towards the next older tap
+        DelayInterpolation interpolation{DelayInterpolation::linear};
+        int bufferFrames{1};
+        int mask{0};
+        int chunkSize{1};
+        int writePosition{0};
+        int numChannels{0};
+    };
+}
@@ -12,6 +12,8 @@ TingeTapeAudioProcessorEditor::TingeTapeAudioProcessorEditor(TingeTapeAudioProce
     };
 
     setupSlider(wowSlider);
+    setupSlider(flutterSlider);
+    setupSlider(driftSlider);
     setupSlider(dirtSlider);
     setupSlider(toneSlider);
     setupSlider(lowCutFreqSlider);
@@ -19,14 +21,23 @@ TingeTapeAudioProcessorEditor::TingeTapeAudioProcessorEditor(TingeTapeAudioProce
     setupSlider(highCutFreqSlider);
     setupSlider(highCutQSlider);
 
+    // The slope boxes list the parameter's choices, in order, before they are attached
+    const juce::StringArray slopeChoices{"12 dB/oct", "24 dB/oct", "36 dB/oct", "48 dB/oct"};
+    lowCutSlopeBox.addItemList(slopeChoices, 1);
+    highCutSlopeBox.addItemList(slopeChoices, 1);
+
     // Attachments
     wowAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kWow, wowSlider);
+    flutterAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kFlutter, flutterSlider);
+    driftAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kDrift, driftSlider);
     dirtAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kDirt, dirtSlider);
     toneAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kTone, toneSlider);
     lowCutFreqAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kLowCutFreq, lowCutFreqSlider);
     lowCutQAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kLowCutRes, lowCutQSlider);
     highCutFreqAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kHighCutFreq, highCutFreqSlider);
     highCutQAttachment = std::make_unique<SliderAttachment>(params, TylerAudio::ParameterIDs::kHighCutRes, highCutQSlider);
+    lowCutSlopeAttachment = std::make_unique<ComboBoxAttachment>(params, TylerAudio::ParameterIDs::kLowCutSlope, lowCutSlopeBox);
+    highCutSlopeAttachment = std::make_unique<ComboBoxAttachment>(params, TylerAudio::ParameterIDs::kHighCutSlope, highCutSlopeBox);
     bypassAttachment = std::make_unique<ButtonAttachment>(params, TylerAudio::ParameterIDs::kBypass, bypassButton);
 
     // Labels
@@ -35,32 +46,44 @@ TingeTapeAudioProcessorEditor::TingeTapeAudioProcessorEditor(TingeTapeAudioProce
         l.attachToComponent(&target, true);
     };
     setupLabel(wowLabel, wowSlider);
+    setupLabel(flutterLabel, flutterSlider);
+    setupLabel(driftLabel, driftSlider);
     setupLabel(dirtLabel, dirtSlider);
     setupLabel(toneLabel, toneSlider);
     setupLabel(lowCutFreqLabel, lowCutFreqSlider);
     setupLabel(lowCutQLabel, lowCutQSlider);
     setupLabel(highCutFreqLabel, highCutFreqSlider);
     setupLabel(highCutQLabel, highCutQSlider);
+    setupLabel(lowCutSlopeLabel, lowCutSlopeBox);
+    setupLabel(highCutSlopeLabel, highCutSlopeBox);
 
     // Add components
     addAndMakeVisible(wowSlider);
+    addAndMakeVisible(flutterSlider);
+    addAndMakeVisible(driftSlider);
     addAndMakeVisible(dirtSlider);
     addAndMakeVisible(toneSlider);
     addAndMakeVisible(lowCutFreqSlider);
     addAndMakeVisible(lowCutQSlider);
     addAndMakeVisible(highCutFreqSlider);
     addAndMakeVisible(highCutQSlider);
+    addAndMakeVisible(lowCutSlopeBox);
+    addAndMakeVisible(highCutSlopeBox);
     addAndMakeVisible(bypassButton);
 
     addAndMakeVisible(wowLabel);
+    addAndMakeVisible(flutterLabel);
+    addAndMakeVisible(driftLabel);
     addAndMakeVisible(dirtLabel);
     addAndMakeVisible(toneLabel);
     addAndMakeVisible(lowCutFreqLabel);
     addAndMakeVisible(lowCutQLabel);
     addAndMakeVisible(highCutFreqLabel);
     addAndMakeVisible(highCutQLabel);
+    addAndMakeVisible(lowCutSlopeLabel);
+    addAndMakeVisible(highCutSlopeLabel);
 
-    setSize(520, 260);
+    setSize(520, 372);
 }
 
 TingeTapeAudioProcessorEditor::~TingeTapeAudioProcessorEditor()
@@ -87,11 +110,15 @@ void TingeTapeAudioProcessorEditor::resized()
     int y = 34;
 
     wowSlider.setBounds(x0, y, w, 20);              y += rowHeight;
+    flutterSlider.setBounds(x0, y, w, 20);          y += rowHeight;
+    driftSlider.setBounds(x0, y, w, 20);            y += rowHeight;
     dirtSlider.setBounds(x0, y, w, 20);             y += rowHeight;
     toneSlider.setBounds(x0, y, w, 20);             y += rowHeight;
     lowCutFreqSlider.setBounds(x0, y, w, 20);       y += rowHeight;
     lowCutQSlider.setBounds(x0, y, w, 20);          y += rowHeight;
+    lowCutSlopeBox.setBounds(x0, y, 120, 20);       y += rowHeight;
     highCutFreqSlider.setBounds(x0, y, w, 20);      y += rowHeight;
     highCutQSlider.setBounds(x0, y, w, 20);         y += rowHeight;
+    highCutSlopeBox.setBounds(x0, y, 120, 20);      y += rowHeight;
     bypassButton.setBounds(x0, y + 4, 100, 20);
 }
\ No newline at end of file
@@ -17,33 +17,46 @@ private:
 
     // Controls
     juce::Slider wowSlider;
+    juce::Slider flutterSlider;
+    juce::Slider driftSlider;
     juce::Slider dirtSlider;
     juce::Slider toneSlider;
     juce::Slider lowCutFreqSlider;
     juce::Slider lowCutQSlider;
     juce::Slider highCutFreqSlider;
     juce::Slider highCutQSlider;
+    juce::ComboBox lowCutSlopeBox;
+    juce::ComboBox highCutSlopeBox;
     juce::ToggleButton bypassButton { "Bypass" };
 
     // Labels
     juce::Label wowLabel { {}, "Wow" };
+    juce::Label flutterLabel { {}, "Flutter" };
+    juce::Label driftLabel { {}, "Drift" };
     juce::Label dirtLabel { {}, "Dirt" };
     juce::Label toneLabel { {}, "Tone" };
     juce::Label lowCutFreqLabel { {}, "Low Cut" };
     juce::Label lowCutQLabel { {}, "Low Cut Q" };
     juce::Label highCutFreqLabel { {}, "High Cut" };
     juce::Label highCutQLabel { {}, "High Cut Q" };
+    juce::Label lowCutSlopeLabel { {}, "Low Slope" };
+    juce::Label highCutSlopeLabel { {}, "High Slope" };
 
     // Attachments
     using SliderAttachment = juce::AudioProcessorValueTreeState::SliderAttachment;
     using ButtonAttachment = juce::AudioProcessorValueTreeState::ButtonAttachment;
+    using ComboBoxAttachment = juce::AudioProcessorValueTreeState::ComboBoxAttachment;
     std::unique_ptr<SliderAttachment> wowAttachment;
+    std::unique_ptr<SliderAttachment> flutterAttachment;
+    std::unique_ptr<SliderAttachment> driftAttachment;
     std::unique_ptr<SliderAttachment> dirtAttachment;
     std::unique_ptr<SliderAttachment> toneAttachment;
     std::unique_ptr<SliderAttachment> lowCutFreqAttachment;
     std::unique_ptr<SliderAttachment> lowCutQAttachment;
     std::unique_ptr<SliderAttachment> highCutFreqAttachment;
     std::unique_ptr<SliderAttachment> highCutQAttachment;
+    std::unique_ptr<ComboBoxAttachment> lowCutSlopeAttachment;
+    std::unique_ptr<ComboBoxAttachment> highCutSlopeAttachment;
     std::unique_ptr<ButtonAttachment> bypassAttachment;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TingeTapeAudioProcessorEditor)
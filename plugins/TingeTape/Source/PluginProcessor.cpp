@@ -1,6 +1,32 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+namespace
+{
+    // Settings kept in the plugin state alongside the parameters
+    constexpr char kRealtimeOversamplingProperty[] = "realtimeOversampling";
+    constexpr char kOfflineOversamplingProperty[] = "offlineOversampling";
+    constexpr char kOversamplingFilterProperty[] = "oversamplingFilter";
+    constexpr char kSaturationAntialiasingProperty[] = "saturationAntialiasing";
+    constexpr char kSaturationModelProperty[] = "saturationModel";
+    constexpr char kRealtimeHysteresisSolverProperty[] = "realtimeHysteresisSolver";
+    constexpr char kOfflineHysteresisSolverProperty[] = "offlineHysteresisSolver";
+    constexpr char kCutFilterTopologyProperty[] = "cutFilterTopology";
+    
+    // A cut filter's sections run in series, so their decay times add up
+    double cutFilterDecayTimeSeconds(double frequency, double resonance, int numSections, double decayDb) noexcept
+    {
+        using namespace TylerAudio::TingeTape;
+        
+        double seconds = 0.0;
+        
+        for (int section = 0; section < numSections; ++section)
+            seconds += BiquadDesign::decayTimeSeconds(frequency, BiquadDesign::resonantSectionQ(numSections, section, resonance), decayDb);
+        
+        return seconds;
+    }
+}
+
 TingeTapeAudioProcessor::TingeTapeAudioProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
     : AudioProcessor(BusesProperties()
@@ -18,23 +44,17 @@ TingeTapeAudioProcessor::TingeTapeAudioProcessor()
 {
     // Get atomic parameter pointers for realtime access
     wowParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kWow);
+    flutterParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kFlutter);
+    driftParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kDrift);
     lowCutFreqParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kLowCutFreq);
     lowCutResParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kLowCutRes);
     highCutFreqParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kHighCutFreq);
     highCutResParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kHighCutRes);
+    lowCutSlopeParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kLowCutSlope);
+    highCutSlopeParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kHighCutSlope);
     dirtParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kDirt);
     toneParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kTone);
     bypassParameter = parameters.getRawParameterValue(TylerAudio::ParameterIDs::kBypass);
-    
-    // Set up parameter callbacks for all parameters
-    parameters.addParameterListener(TylerAudio::ParameterIDs::kWow, this);
-    parameters.addParameterListener(TylerAudio::ParameterIDs::kLowCutFreq, this);
-    parameters.addParameterListener(TylerAudio::ParameterIDs::kLowCutRes, this);
-    parameters.addParameterListener(TylerAudio::ParameterIDs::kHighCutFreq, this);
-    parameters.addParameterListener(TylerAudio::ParameterIDs::kHighCutRes, this);
-    parameters.addParameterListener(TylerAudio::ParameterIDs::kDirt, this);
-    parameters.addParameterListener(TylerAudio::ParameterIDs::kTone, this);
-    parameters.addParameterListener(TylerAudio::ParameterIDs::kBypass, this);
 }
 
 TingeTapeAudioProcessor::~TingeTapeAudioProcessor()
@@ -75,7 +95,29 @@ bool TingeTapeAudioProcessor::isMidiEffect() const
 
 double TingeTapeAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    return calculateTailLengthSeconds(lowCutFreqParameter->load(), lowCutResParameter->load(),
+                                      highCutFreqParameter->load(), highCutResParameter->load());
+}
+
+// The stages run in series, so their individual decay times add up
+double TingeTapeAudioProcessor::calculateTailLengthSeconds(float lowCutFreq, float lowCutRes,
+                                                           float highCutFreq, float highCutRes) const noexcept
+{
+    using namespace TylerAudio::TingeTape;
+    
+    const double sampleRate = currentSampleRate;
+    const auto maxFreq = sampleRate * 0.49;
+    
+    return cutFilterDecayTimeSeconds(juce::jlimit(20.0, maxFreq, static_cast<double>(lowCutFreq)),
+                                     juce::jmax(0.1, static_cast<double>(lowCutRes)),
+                                     getNumCutFilterSections(*lowCutSlopeParameter), kTailDecayDb)
+         + TapeSaturation<float>::getTailLengthSeconds(sampleRate, kTailDecayDb, saturationModel.load())
+         + ToneControl<float>::getTailLengthSeconds(kTailDecayDb)
+         + cutFilterDecayTimeSeconds(juce::jlimit(20.0, maxFreq, static_cast<double>(highCutFreq)),
+                                     juce::jmax(0.1, static_cast<double>(highCutRes)),
+                                     getNumCutFilterSections(*highCutSlopeParameter), kTailDecayDb)
+         + WowEngine<float>::getTailLengthSeconds()
+         + getLatencySamples() / sampleRate;
 }
 
 int TingeTapeAudioProcessor::getNumPrograms()
@@ -103,10 +145,15 @@ void TingeTapeAudioProcessor::changeProgramName(int index, const juce::String& n
 
 void TingeTapeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    currentSampleRate = sampleRate;
+    cutFilterTables = cutFilterTableCache->getTables(sampleRate);
+    
     // Research-compliant parameter smoothing times
     // Wow parameters: 50ms (prevents modulation artifacts)
     const double wowSmoothingTime = 0.05;
     wowSmoother.setSmoothingTime(wowSmoothingTime, sampleRate);
+    flutterSmoother.setSmoothingTime(wowSmoothingTime, sampleRate);
+    driftSmoother.setSmoothingTime(wowSmoothingTime, sampleRate);
     
     // Filter parameters: 20ms (prevents clicks)
     const double filterSmoothingTime = 0.02;
@@ -121,16 +168,12 @@ void TingeTapeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     dirtSmoother.setSmoothingTime(driveSmoothingTime, sampleRate);
     
     // Set smoother targets from current parameter values before snapping
-    wowSmoother.setTargetValue(wowParameter->load());
-    lowCutFreqSmoother.setTargetValue(lowCutFreqParameter->load());
-    lowCutResSmoother.setTargetValue(lowCutResParameter->load());
-    highCutFreqSmoother.setTargetValue(highCutFreqParameter->load());
-    highCutResSmoother.setTargetValue(highCutResParameter->load());
-    dirtSmoother.setTargetValue(dirtParameter->load());
-    toneSmoother.setTargetValue(toneParameter->load());
+    updateSmootherTargets();
     
     // Snap all smoothers to current values
     wowSmoother.snapToTarget();
+    flutterSmoother.snapToTarget();
+    driftSmoother.snapToTarget();
     lowCutFreqSmoother.snapToTarget();
     lowCutResSmoother.snapToTarget();
     highCutFreqSmoother.snapToTarget();
@@ -138,32 +181,137 @@ void TingeTapeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     dirtSmoother.snapToTarget();
     toneSmoother.snapToTarget();
     
+    dirtRamp.reset(dirtSmoother.getCurrentValue());
+    toneRamp.reset(toneSmoother.getCurrentValue());
+    wowRamp.reset(wowSmoother.getCurrentValue());
+    flutterRamp.reset(flutterSmoother.getCurrentValue());
+    driftRamp.reset(driftSmoother.getCurrentValue());
+    lowCutFreqRamp.reset(lowCutFreqSmoother.getCurrentValue());
+    lowCutResRamp.reset(lowCutResSmoother.getCurrentValue());
+    highCutFreqRamp.reset(highCutFreqSmoother.getCurrentValue());
+    highCutResRamp.reset(highCutResSmoother.getCurrentValue());
+    
     // Prepare DSP components
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
+    maxSubBlockSize = juce::jmax(1, samplesPerBlock);
+    numPreparedChannels = juce::jlimit(1, TylerAudio::TingeTape::kMaxChannels, getTotalNumOutputChannels());
+    
+    // Allocate the per-sample control buffers up front so processBlock never allocates
+    dirtControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    toneControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    wowControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    flutterControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    driftControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    lowCutFreqControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    lowCutResControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    highCutFreqControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    highCutResControlBuffer.assign(static_cast<size_t>(maxSubBlockSize), 0.0f);
+    
+    floatChain.tapeSaturation.setTransferTablesEnabled(saturationTables.load());
+    doubleChain.tapeSaturation.setTransferTablesEnabled(saturationTables.load());
+    
+    // Prepare both precisions so the host can switch between them without reallocating
+    floatChain.prepare(sampleRate, maxSubBlockSize, numPreparedChannels);
+    doubleChain.prepare(sampleRate, maxSubBlockSize, numPreparedChannels);
+    updateCutFilterSlopes(floatChain);
+    updateCutFilterSlopes(doubleChain);
+    resetStageSwitches();
+    
+    silentSamples = 0;
+    isIdle = false;
+    
+    controlInterval = 0;  // Force the control rate to be applied to every stage
+    updateControlInterval();
+    activeCutFilterTopology = cutFilterTopology.load();
+    
+    // Apply the oversampling for the current render mode so its latency is known up front
+    activeOversamplingFactor = getRequiredOversamplingFactor();
+    activeOversamplingFilter = oversamplingFilter.load();
+    applyOversampling();
     
+    // Initialize filter coefficients with current parameter values
+    updateFilters(floatChain);
+    updateFilters(doubleChain);
+}
+
+template <typename SampleType>
+void TingeTapeAudioProcessor::ProcessingChain<SampleType>::prepare(double sampleRate, int maxBlockSize, int numChannels)
+{
     // Prepare wow engine
-    wowEngine.prepare(sampleRate, samplesPerBlock, static_cast<int>(spec.numChannels));
+    wowEngine.prepare(sampleRate, maxBlockSize, numChannels);
     
-    // Prepare filters
-    lowCutFilter.prepare(spec);
-    highCutFilter.prepare(spec);
+    // Prepare saturation, and the tone control with the cut filters ahead of its shelves
+    tapeSaturation.prepare(sampleRate, maxBlockSize, numChannels);
+    toneControl.prepare(sampleRate, maxBlockSize, numChannels, numLowCutSections + numHighCutSections);
     
-    // Prepare saturation and tone control
-    tapeSaturation.prepare(sampleRate);
-    toneControl.prepare(sampleRate);
+    using FilterType = typename TylerAudio::TingeTape::SIMDStateVariableFilter<SampleType>::Type;
+    lowCutStateVariable.prepare(sampleRate, maxBlockSize, numChannels, FilterType::highPass);
+    highCutStateVariable.prepare(sampleRate, maxBlockSize, numChannels, FilterType::lowPass);
+    lowCutStateVariable.setNumStages(numLowCutSections);
+    highCutStateVariable.setNumStages(numHighCutSections);
     
-    // Reset all DSP components
-    lowCutFilter.reset();
-    highCutFilter.reset();
+    dirtSwitch.prepare(sampleRate, maxBlockSize, numChannels);
+    wowSwitch.prepare(sampleRate, maxBlockSize, numChannels);
+    
+    reset();
+}
+
+template <typename SampleType>
+void TingeTapeAudioProcessor::ProcessingChain<SampleType>::reset() noexcept
+{
     wowEngine.reset();
     tapeSaturation.reset();
     toneControl.reset();
+    resetCutFilters();
+}
+
+template <typename SampleType>
+void TingeTapeAudioProcessor::ProcessingChain<SampleType>::resetCutFilters() noexcept
+{
+    toneControl.resetFixedSections();
+    lowCutStateVariable.reset();
+    highCutStateVariable.reset();
+}
+
+// Resizes the cut filters in the cascade without disturbing the sections they keep: the
+// high-cut and the shelves move to make room or close the gap, in whichever order keeps
+// them from overwriting each other, and only the sections added start from silence. The
+// caller writes the new coefficients before the next block.
+template <typename SampleType>
+void TingeTapeAudioProcessor::ProcessingChain<SampleType>::setCutFilterSlopes(int newNumLowCutSections,
+                                                                              int newNumHighCutSections) noexcept
+{
+    if (newNumLowCutSections == numLowCutSections && newNumHighCutSections == numHighCutSections)
+        return;
     
-    // Initialize filter coefficients with current parameter values
-    updateFilters();
+    const int numCutSections = numLowCutSections + numHighCutSections;
+    const int newNumCutSections = newNumLowCutSections + newNumHighCutSections;
+    
+    if (newNumCutSections > numCutSections)
+        toneControl.setNumFixedSections(newNumCutSections);
+    
+    toneControl.moveFixedSections(numLowCutSections, newNumLowCutSections, juce::jmin(numHighCutSections, newNumHighCutSections));
+    
+    if (newNumCutSections < numCutSections)
+        toneControl.setNumFixedSections(newNumCutSections);
+    
+    if (newNumLowCutSections > numLowCutSections)
+        toneControl.resetFixedSections(numLowCutSections, newNumLowCutSections - numLowCutSections);
+    
+    if (newNumHighCutSections > numHighCutSections)
+        toneControl.resetFixedSections(newNumLowCutSections + numHighCutSections, newNumHighCutSections - numHighCutSections);
+    
+    numLowCutSections = newNumLowCutSections;
+    numHighCutSections = newNumHighCutSections;
+    lowCutStateVariable.setNumStages(numLowCutSections);
+    highCutStateVariable.setNumStages(numHighCutSections);
+}
+
+template <typename SampleType>
+void TingeTapeAudioProcessor::ProcessingChain<SampleType>::setControlInterval(int numSamples) noexcept
+{
+    wowEngine.setControlInterval(numSamples);
+    tapeSaturation.setControlInterval(numSamples);
+    toneControl.setControlInterval(numSamples);
 }
 
 void TingeTapeAudioProcessor::releaseResources()
@@ -177,8 +325,9 @@ bool TingeTapeAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts)
     juce::ignoreUnused(layouts);
     return true;
 #else
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-        && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Any layout up to 16 channels; all channels share one wow modulation
+    const auto& outputSet = layouts.getMainOutputChannelSet();
+    if (outputSet.isDisabled() || outputSet.size() > TylerAudio::TingeTape::kMaxChannels)
         return false;
 
 #if ! JucePlugin_IsSynth
@@ -193,8 +342,21 @@ bool TingeTapeAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts)
 
 void TingeTapeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) noexcept
 {
-    juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
+    processBlockWithChain(buffer, floatChain);
+}
+
+void TingeTapeAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages) noexcept
+{
+    juce::ignoreUnused(midiMessages);
+    processBlockWithChain(buffer, doubleChain);
+}
+
+template <typename SampleType>
+void TingeTapeAudioProcessor::processBlockWithChain(juce::AudioBuffer<SampleType>& buffer,
+                                                    ProcessingChain<SampleType>& chain) noexcept
+{
+    juce::ScopedNoDenormals noDenormals;
     
     const auto totalNumInputChannels = getTotalNumInputChannels();
     const auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -209,81 +371,400 @@ void TingeTapeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     if (isBypassed)
         return;  // Early return for bypass
 
+    if (maxSubBlockSize == 0)
+        return;  // Not prepared yet
+    
+    updateSmootherTargets();
+
     // Use JUCE's AudioBlock for efficient processing
-    auto block = juce::dsp::AudioBlock<float>(buffer);
+    const auto numChannels = juce::jmin(static_cast<size_t>(numPreparedChannels),
+                                        static_cast<size_t>(buffer.getNumChannels()));
+    auto block = juce::dsp::AudioBlock<SampleType>(buffer).getSubsetChannelBlock(0, numChannels);
+    
+    updateControlInterval();
+    updateOversampling();
+    updateCutFilterTopology();
+    updateCutFilterSlopes(chain);
+    chain.wowEngine.setInterpolation(wowInterpolation.load());
+    chain.tapeSaturation.setKernel(saturationKernel.load());
+    chain.tapeSaturation.setAntialiasing(saturationAntialiasing.load());
+    chain.tapeSaturation.setModel(saturationModel.load());
+    chain.tapeSaturation.setHysteresisSolver(getHysteresisSolver(isNonRealtime()));
+    
+    // Count how long the input has been silent. If the silence already covered the whole
+    // tail before this block, everything inside the chain has decayed below the threshold
+    // and the output is silence too.
+    const int previousSilentSamples = silentSamples;
+    const bool inputIsSilent = isInputSilent(block);
+    silentSamples = inputIsSilent ? juce::jmin(previousSilentSamples + numSamples, std::numeric_limits<int>::max() / 2) : 0;
+    
+    if (inputIsSilent)
+    {
+        const double tailSeconds = calculateTailLengthSeconds(lowCutFreqSmoother.getCurrentValue(),
+                                                              lowCutResSmoother.getCurrentValue(),
+                                                              highCutFreqSmoother.getCurrentValue(),
+                                                              highCutResSmoother.getCurrentValue());
+        
+        if (previousSilentSamples >= static_cast<int>(std::ceil(tailSeconds * currentSampleRate)))
+        {
+            enterIdleState();
+            block.clear();
+            return;
+        }
+    }
     
-    // Update filter coefficients with smoothed parameters
-    updateFilters();
+    isIdle = false;
+    
+    // Run the chain over sub-blocks no larger than the prepared control buffers
+    for (int offset = 0; offset < numSamples; offset += maxSubBlockSize)
+    {
+        const auto subBlockSize = juce::jmin(maxSubBlockSize, numSamples - offset);
+        auto subBlock = block.getSubBlock(static_cast<size_t>(offset), static_cast<size_t>(subBlockSize));
+        processSubBlock(subBlock, chain);
+    }
+}
+
+template <typename SampleType>
+void TingeTapeAudioProcessor::processSubBlock(juce::dsp::AudioBlock<SampleType>& block,
+                                              ProcessingChain<SampleType>& chain) noexcept
+{
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    
+    // Pre-render the smoothed per-sample parameter values for this sub-block; the
+    // smoothers are stepped at the control rate and ramped linearly in between
+    auto* dirtValues = dirtControlBuffer.data();
+    auto* toneValues = toneControlBuffer.data();
+    auto* wowValues = wowControlBuffer.data();
+    auto* flutterValues = flutterControlBuffer.data();
+    auto* driftValues = driftControlBuffer.data();
+    
+    dirtRamp.render(dirtSmoother, dirtValues, numSamples, controlInterval);
+    toneRamp.render(toneSmoother, toneValues, numSamples, controlInterval);
+    wowRamp.render(wowSmoother, wowValues, numSamples, controlInterval);
+    flutterRamp.render(flutterSmoother, flutterValues, numSamples, controlInterval);
+    driftRamp.render(driftSmoother, driftValues, numSamples, controlInterval);
     
     // Signal Chain: Input → Low-Cut Filter → Dirt/Saturation → Tone Control → High-Cut Filter → Wow Modulation → Output
+    // The biquad low-cut, tone shelves and high-cut share one cascade, so the filters take
+    // one pass over the sub-block while Dirt is off and two either side of it while it
+    // runs. Neutral stages are skipped.
+    using StageState = typename TylerAudio::TingeTape::StageSwitch<SampleType>::State;
+    
+    const int numCutSections = chain.numLowCutSections + chain.numHighCutSections;
+    const bool toneNeeded = isStageNeeded(toneSmoother);
+    const bool dirtNeeded = isDirtStageNeeded();
     
-    // Step 1: Apply Low-Cut Filter (High-Pass)
-    juce::dsp::ProcessContextReplacing<float> context(block);
-    lowCutFilter.process(context);
+    if (toneNeeded && ! chain.toneActive)
+        chain.toneControl.resetShelves();
     
-    // Step 2-6: Process each sample through the remaining chain
-    for (int sample = 0; sample < numSamples; ++sample)
+    chain.toneActive = toneNeeded;
+    
+    auto processDirt = [&]
     {
-        // Get smoothed parameters for this sample
-        const float dirt = dirtSmoother.getNextValue();
-        const float tone = toneSmoother.getNextValue();
-        const float wow = wowSmoother.getNextValue();
+        if (const auto state = chain.dirtSwitch.beginBlock(block, dirtNeeded); state != StageState::skipped)
+        {
+            if (state == StageState::started)
+                chain.tapeSaturation.reset();
+            
+            chain.tapeSaturation.process(block, dirtValues);
+            chain.dirtSwitch.endBlock(block);
+        }
+    };
+    
+    // Runs the filters from the given cut filter section to the end of the linear stages
+    auto processFilters = [&](int firstSection)
+    {
+        if (toneNeeded)
+            chain.toneControl.process(block, toneValues, firstSection);
+        else
+            chain.toneControl.processFixed(block, firstSection, numCutSections - firstSection);
+    };
+    
+    if (activeCutFilterTopology == TylerAudio::TingeTape::CutFilterTopology::stateVariable)
+    {
+        auto* lowCutFreqValues = lowCutFreqControlBuffer.data();
+        auto* lowCutResValues = lowCutResControlBuffer.data();
+        auto* highCutFreqValues = highCutFreqControlBuffer.data();
+        auto* highCutResValues = highCutResControlBuffer.data();
+        
+        lowCutFreqRamp.render(lowCutFreqSmoother, lowCutFreqValues, numSamples, controlInterval);
+        lowCutResRamp.render(lowCutResSmoother, lowCutResValues, numSamples, controlInterval);
+        highCutFreqRamp.render(highCutFreqSmoother, highCutFreqValues, numSamples, controlInterval);
+        highCutResRamp.render(highCutResSmoother, highCutResValues, numSamples, controlInterval);
         
-        // Update DSP component parameters
-        tapeSaturation.setDrive(dirt);
-        toneControl.setTone(tone);
-        wowEngine.setDepth(wow);
+        chain.lowCutStateVariable.process(block, lowCutFreqValues, lowCutResValues);
+        processDirt();
         
-        // Process each channel
-        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+        if (toneNeeded)
+            chain.toneControl.process(block, toneValues, numCutSections);
+        
+        chain.highCutStateVariable.process(block, highCutFreqValues, highCutResValues);
+    }
+    else
+    {
+        // Advance the cut filter smoothers over the sub-block and design the biquads once
+        // from where they land
+        lowCutFreqSmoother.skip(numSamples);
+        lowCutResSmoother.skip(numSamples);
+        highCutFreqSmoother.skip(numSamples);
+        highCutResSmoother.skip(numSamples);
+        updateFilters(chain);
+        
+        if (chain.dirtSwitch.willSkip(dirtNeeded))
         {
-            float sample_val = block.getSample(channel, sample);
-            
-            // Step 2: Apply tape saturation/dirt
-            sample_val = tapeSaturation.processSample(sample_val);
-            
-            // Step 3: Apply tone control
-            sample_val = toneControl.processSample(sample_val);
-            
-            // Step 4: High-Cut Filter will be applied after sample loop
-            
-            // Step 5: Apply wow modulation (pitch modulation)
-            sample_val = wowEngine.getNextSample(sample_val, static_cast<int>(channel));
-            
-            // Denormal protection and sanitization
-            sample_val = TylerAudio::Utils::sanitizeFloat(sample_val);
-            
-            block.setSample(channel, sample, sample_val);
+            processFilters(0);
+        }
+        else
+        {
+            chain.toneControl.processFixed(block, 0, chain.numLowCutSections);
+            processDirt();
+            processFilters(chain.numLowCutSections);
         }
     }
     
-    // Step 4: Apply High-Cut Filter (Low-Pass) to entire block
-    highCutFilter.process(context);
+    if (chain.wowSwitch.beginBlock(block, isWowStageNeeded()) != StageState::skipped)
+    {
+        chain.wowEngine.process(block, wowValues, flutterValues, driftValues);
+        chain.wowSwitch.endBlock(block);
+    }
+    else
+    {
+        chain.wowEngine.processBypassed(block);
+    }
+    
+    // Denormal protection and sanitization
+    const auto threshold = static_cast<SampleType>(TylerAudio::Constants::kDenormalThreshold);
+    
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        auto* data = block.getChannelPointer(channel);
+        
+        for (int i = 0; i < numSamples; ++i)
+            if (std::abs(data[i]) < threshold || ! std::isfinite(data[i]))
+                data[i] = SampleType(0);
+    }
 }
 
-// Helper method to update filter coefficients
-void TingeTapeAudioProcessor::updateFilters()
+template <typename SampleType>
+bool TingeTapeAudioProcessor::isInputSilent(const juce::dsp::AudioBlock<SampleType>& block) const noexcept
 {
-    const float lowCutFreq = lowCutFreqSmoother.getNextValue();
-    const float lowCutRes = lowCutResSmoother.getNextValue();
-    const float highCutFreq = highCutFreqSmoother.getNextValue();
-    const float highCutRes = highCutResSmoother.getNextValue();
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        const auto range = juce::FloatVectorOperations::findMinAndMax(block.getChannelPointer(channel),
+                                                                      static_cast<int>(block.getNumSamples()));
+        
+        if (range.getStart() < -SampleType(kSilenceThreshold) || range.getEnd() > SampleType(kSilenceThreshold))
+            return false;
+    }
     
-    const double sampleRate = getSampleRate();
+    return true;
+}
+
+// While idle the smoothers jump straight to their targets, so processing resumes with the
+// current settings instead of ramping from stale values
+void TingeTapeAudioProcessor::enterIdleState() noexcept
+{
+    wowSmoother.snapToTarget();
+    flutterSmoother.snapToTarget();
+    driftSmoother.snapToTarget();
+    lowCutFreqSmoother.snapToTarget();
+    lowCutResSmoother.snapToTarget();
+    highCutFreqSmoother.snapToTarget();
+    highCutResSmoother.snapToTarget();
+    dirtSmoother.snapToTarget();
+    toneSmoother.snapToTarget();
     
-    // Clamp frequencies to safe minimums to prevent 0 Hz coefficients
-    const float clampedLowCutFreq = juce::jmax(20.0f, lowCutFreq);
-    const float clampedHighCutFreq = juce::jmax(20.0f, highCutFreq);
+    dirtRamp.reset(dirtSmoother.getCurrentValue());
+    toneRamp.reset(toneSmoother.getCurrentValue());
+    wowRamp.reset(wowSmoother.getCurrentValue());
+    flutterRamp.reset(flutterSmoother.getCurrentValue());
+    driftRamp.reset(driftSmoother.getCurrentValue());
+    lowCutFreqRamp.reset(lowCutFreqSmoother.getCurrentValue());
+    lowCutResRamp.reset(lowCutResSmoother.getCurrentValue());
+    highCutFreqRamp.reset(highCutFreqSmoother.getCurrentValue());
+    highCutResRamp.reset(highCutResSmoother.getCurrentValue());
     
-    // Update Low-Cut Filter (High-Pass)
-    auto lowCutCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighPass(
-        sampleRate, clampedLowCutFreq, lowCutRes);
-    *lowCutFilter.state = *lowCutCoeffs;
+    if (isIdle)
+        return;
     
-    // Update High-Cut Filter (Low-Pass)  
-    auto highCutCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-        sampleRate, clampedHighCutFreq, highCutRes);
-    *highCutFilter.state = *highCutCoeffs;
+    // Clear the residue that decayed below the threshold so the chain restarts from silence
+    floatChain.reset();
+    doubleChain.reset();
+    resetStageSwitches();
+    isIdle = true;
+}
+
+// Puts each stage straight into the on/off state its current setting calls for
+void TingeTapeAudioProcessor::resetStageSwitches() noexcept
+{
+    const bool dirtNeeded = isDirtStageNeeded();
+    const bool toneNeeded = isStageNeeded(toneSmoother);
+    const bool wowNeeded = isWowStageNeeded();
+    
+    floatChain.dirtSwitch.reset(dirtNeeded);
+    floatChain.wowSwitch.reset(wowNeeded);
+    floatChain.toneActive = toneNeeded;
+    doubleChain.dirtSwitch.reset(dirtNeeded);
+    doubleChain.wowSwitch.reset(wowNeeded);
+    doubleChain.toneActive = toneNeeded;
+}
+
+// Dirt, tone, wow, flutter and drift are neutral at zero; a stage is only skipped once its parameter
+// is there and the smoother has stopped moving
+bool TingeTapeAudioProcessor::isStageNeeded(const TylerAudio::Utils::SmoothingFilter& smoother) noexcept
+{
+    constexpr float neutralRange = 0.1f;  // 0.001 of the ±100 parameter range
+    return std::abs(smoother.getTargetValue()) > neutralRange || ! smoother.isSettled();
+}
+
+// An oversampled Dirt stage adds latency, so it has to stay in the signal path to keep the
+// reported latency true even while its setting is neutral
+bool TingeTapeAudioProcessor::isDirtStageNeeded() const noexcept
+{
+    return isStageNeeded(dirtSmoother) || activeOversamplingFactor != TylerAudio::TingeTape::OversamplingFactor::x1;
+}
+
+// Wow, flutter and drift share one modulated delay, which runs while any of them is active
+bool TingeTapeAudioProcessor::isWowStageNeeded() const noexcept
+{
+    return isStageNeeded(wowSmoother) || isStageNeeded(flutterSmoother) || isStageNeeded(driftSmoother);
+}
+
+void TingeTapeAudioProcessor::setOversamplingFactor(TylerAudio::TingeTape::OversamplingFactor factor,
+                                                    bool forNonRealtime) noexcept
+{
+    (forNonRealtime ? offlineOversampling : realtimeOversampling).store(factor);
+}
+
+TylerAudio::TingeTape::OversamplingFactor TingeTapeAudioProcessor::getOversamplingFactor(bool forNonRealtime) const noexcept
+{
+    return (forNonRealtime ? offlineOversampling : realtimeOversampling).load();
+}
+
+void TingeTapeAudioProcessor::setHysteresisSolver(TylerAudio::TingeTape::HysteresisSolver solver,
+                                                  bool forNonRealtime) noexcept
+{
+    (forNonRealtime ? offlineHysteresisSolver : realtimeHysteresisSolver).store(solver);
+}
+
+TylerAudio::TingeTape::HysteresisSolver TingeTapeAudioProcessor::getHysteresisSolver(bool forNonRealtime) const noexcept
+{
+    return (forNonRealtime ? offlineHysteresisSolver : realtimeHysteresisSolver).load();
+}
+
+// The factor for the current render mode, raised to 2x if the hysteresis model needs it
+TylerAudio::TingeTape::OversamplingFactor TingeTapeAudioProcessor::getRequiredOversamplingFactor() const noexcept
+{
+    using TylerAudio::TingeTape::OversamplingFactor;
+    
+    const auto factor = getOversamplingFactor(isNonRealtime());
+    
+    if (saturationModel.load() == TylerAudio::TingeTape::SaturationModel::hysteresis && factor == OversamplingFactor::x1)
+        return OversamplingFactor::x2;
+    
+    return factor;
+}
+
+// Picks up oversampling changes and switches between the realtime and offline factors
+// when the host changes render mode or the saturation model
+void TingeTapeAudioProcessor::updateOversampling() noexcept
+{
+    const auto factor = getRequiredOversamplingFactor();
+    const auto filter = oversamplingFilter.load();
+    
+    if (factor == activeOversamplingFactor && filter == activeOversamplingFilter)
+        return;
+    
+    activeOversamplingFactor = factor;
+    activeOversamplingFilter = filter;
+    applyOversampling();
+}
+
+void TingeTapeAudioProcessor::applyOversampling() noexcept
+{
+    floatChain.tapeSaturation.setOversampling(activeOversamplingFactor, activeOversamplingFilter);
+    doubleChain.tapeSaturation.setOversampling(activeOversamplingFactor, activeOversamplingFilter);
+    setLatencySamples(floatChain.tapeSaturation.getLatencySamples());
+}
+
+// Switching topology leaves the other pair of filters holding stale state, so both pairs
+// restart from silence, and the per-sample cutoffs from the smoothers' current values
+void TingeTapeAudioProcessor::updateCutFilterTopology() noexcept
+{
+    const auto topology = cutFilterTopology.load();
+    
+    if (topology == activeCutFilterTopology)
+        return;
+    
+    activeCutFilterTopology = topology;
+    lowCutFreqRamp.reset(lowCutFreqSmoother.getCurrentValue());
+    lowCutResRamp.reset(lowCutResSmoother.getCurrentValue());
+    highCutFreqRamp.reset(highCutFreqSmoother.getCurrentValue());
+    highCutResRamp.reset(highCutResSmoother.getCurrentValue());
+    floatChain.resetCutFilters();
+    doubleChain.resetCutFilters();
+}
+
+// Picks up slope changes for one chain; the other catches up when it next processes
+template <typename SampleType>
+void TingeTapeAudioProcessor::updateCutFilterSlopes(ProcessingChain<SampleType>& chain) noexcept
+{
+    chain.setCutFilterSlopes(getNumCutFilterSections(*lowCutSlopeParameter),
+                             getNumCutFilterSections(*highCutSlopeParameter));
+}
+
+// Slope choices run from 12 dB/oct up in steps of one 12 dB/oct section
+int TingeTapeAudioProcessor::getNumCutFilterSections(const std::atomic<float>& slopeParameter) noexcept
+{
+    return juce::jlimit(1, TylerAudio::TingeTape::BiquadDesign::kMaxCascadeSections,
+                        juce::roundToInt(slopeParameter.load()) + 1);
+}
+
+// Applies a control rate change to the smoothers and the stages that follow it
+void TingeTapeAudioProcessor::updateControlInterval() noexcept
+{
+    const auto newInterval = static_cast<int>(controlRate.load());
+    
+    if (newInterval == controlInterval)
+        return;
+    
+    controlInterval = newInterval;
+    
+    dirtSmoother.setControlInterval(controlInterval);
+    toneSmoother.setControlInterval(controlInterval);
+    wowSmoother.setControlInterval(controlInterval);
+    flutterSmoother.setControlInterval(controlInterval);
+    driftSmoother.setControlInterval(controlInterval);
+    lowCutFreqSmoother.setControlInterval(controlInterval);
+    lowCutResSmoother.setControlInterval(controlInterval);
+    highCutFreqSmoother.setControlInterval(controlInterval);
+    highCutResSmoother.setControlInterval(controlInterval);
+    floatChain.setControlInterval(controlInterval);
+    doubleChain.setControlInterval(controlInterval);
+}
+
+// Helper method to update filter coefficients
+template <typename SampleType>
+void TingeTapeAudioProcessor::updateFilters(ProcessingChain<SampleType>& chain) noexcept
+{
+    const float lowCutFreq = lowCutFreqSmoother.getCurrentValue();
+    const float lowCutRes = lowCutResSmoother.getCurrentValue();
+    const float highCutFreq = highCutFreqSmoother.getCurrentValue();
+    const float highCutRes = highCutResSmoother.getCurrentValue();
+    
+    // Look the coefficients up in place - no trig and no allocation on the audio thread.
+    // The tables clamp to the parameter ranges and below Nyquist. Each section of a steeper
+    // slope shares the cutoff and takes its own Q.
+    using TylerAudio::TingeTape::BiquadDesign::resonantSectionQ;
+    
+    for (int section = 0; section < chain.numLowCutSections; ++section)
+        cutFilterTables->lowCut.lookup(chain.toneControl.getFixedCoefficients(section), static_cast<double>(lowCutFreq),
+                                       resonantSectionQ(chain.numLowCutSections, section, static_cast<double>(lowCutRes)));
+    
+    for (int section = 0; section < chain.numHighCutSections; ++section)
+        cutFilterTables->highCut.lookup(chain.toneControl.getFixedCoefficients(chain.numLowCutSections + section),
+                                        static_cast<double>(highCutFreq),
+                                        resonantSectionQ(chain.numHighCutSections, section, static_cast<double>(highCutRes)));
 }
 
 bool TingeTapeAudioProcessor::hasEditor() const
@@ -299,6 +780,15 @@ juce::AudioProcessorEditor* TingeTapeAudioProcessor::createEditor()
 void TingeTapeAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
     auto state = parameters.copyState();
+    state.setProperty(kRealtimeOversamplingProperty, static_cast<int>(getOversamplingFactor(false)), nullptr);
+    state.setProperty(kOfflineOversamplingProperty, static_cast<int>(getOversamplingFactor(true)), nullptr);
+    state.setProperty(kOversamplingFilterProperty, static_cast<int>(getOversamplingFilter()), nullptr);
+    state.setProperty(kSaturationAntialiasingProperty, static_cast<int>(getSaturationAntialiasing()), nullptr);
+    state.setProperty(kSaturationModelProperty, static_cast<int>(getSaturationModel()), nullptr);
+    state.setProperty(kRealtimeHysteresisSolverProperty, static_cast<int>(getHysteresisSolver(false)), nullptr);
+    state.setProperty(kOfflineHysteresisSolverProperty, static_cast<int>(getHysteresisSolver(true)), nullptr);
+    state.setProperty(kCutFilterTopologyProperty, static_cast<int>(getCutFilterTopology()), nullptr);
+    
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
     copyXmlToBinary(*xml, destData);
 }
@@ -311,7 +801,39 @@ void TingeTapeAudioProcessor::setStateInformation(const void* data, int sizeInBy
     {
         if (xmlState->hasTagName(parameters.state.getType()))
         {
-            parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+            const auto state = juce::ValueTree::fromXml(*xmlState);
+            parameters.replaceState(state);
+            
+            // Older sessions have no oversampling, anti-aliasing, hysteresis or cut filter settings and keep the defaults
+            const auto readFactor = [&state](const char* property, TylerAudio::TingeTape::OversamplingFactor fallback)
+            {
+                const int value = state.getProperty(property, static_cast<int>(fallback));
+                return static_cast<TylerAudio::TingeTape::OversamplingFactor>(juce::jlimit(0, 3, value));
+            };
+            
+            setOversamplingFactor(readFactor(kRealtimeOversamplingProperty, getOversamplingFactor(false)), false);
+            setOversamplingFactor(readFactor(kOfflineOversamplingProperty, getOversamplingFactor(true)), true);
+            
+            const int filter = state.getProperty(kOversamplingFilterProperty, static_cast<int>(getOversamplingFilter()));
+            setOversamplingFilter(static_cast<TylerAudio::TingeTape::OversamplingFilter>(juce::jlimit(0, 1, filter)));
+            
+            const int antialiasing = state.getProperty(kSaturationAntialiasingProperty, static_cast<int>(getSaturationAntialiasing()));
+            setSaturationAntialiasing(static_cast<TylerAudio::TingeTape::SaturationAntialiasing>(juce::jlimit(0, 2, antialiasing)));
+            
+            const int model = state.getProperty(kSaturationModelProperty, static_cast<int>(getSaturationModel()));
+            setSaturationModel(static_cast<TylerAudio::TingeTape::SaturationModel>(juce::jlimit(0, 1, model)));
+            
+            const auto readSolver = [&state](const char* property, TylerAudio::TingeTape::HysteresisSolver fallback)
+            {
+                const int value = state.getProperty(property, static_cast<int>(fallback));
+                return static_cast<TylerAudio::TingeTape::HysteresisSolver>(juce::jlimit(0, 2, value));
+            };
+            
+            setHysteresisSolver(readSolver(kRealtimeHysteresisSolverProperty, getHysteresisSolver(false)), false);
+            setHysteresisSolver(readSolver(kOfflineHysteresisSolverProperty, getHysteresisSolver(true)), true);
+            
+            const int topology = state.getProperty(kCutFilterTopologyProperty, static_cast<int>(getCutFilterTopology()));
+            setCutFilterTopology(static_cast<TylerAudio::TingeTape::CutFilterTopology>(juce::jlimit(0, 1, topology)));
         }
     }
 }
@@ -331,6 +853,28 @@ juce::AudioProcessorValueTreeState::ParameterLayout TingeTapeAudioProcessor::cre
         [](float value, int) { return juce::String(value, 1) + "%"; }
     ));
 
+    // Flutter (0-100%) - Fast capstan and pinch roller speed variation, off by default
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        TylerAudio::ParameterIDs::kFlutter,
+        "Flutter",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
+        0.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 1) + "%"; }
+    ));
+
+    // Drift (0-100%) - Slow random speed wander, off by default
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        TylerAudio::ParameterIDs::kDrift,
+        "Drift",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
+        0.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 1) + "%"; }
+    ));
+
     // Low-Cut Frequency (20 Hz - 200 Hz) - Research-specified range
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         TylerAudio::ParameterIDs::kLowCutFreq,
@@ -404,6 +948,23 @@ juce::AudioProcessorValueTreeState::ParameterLayout TingeTapeAudioProcessor::cre
         }
     ));
 
+    // Cut filter slopes, 12 dB/oct per step; the resonance sets the peak at every slope
+    const juce::StringArray slopeChoices{"12 dB/oct", "24 dB/oct", "36 dB/oct", "48 dB/oct"};
+    
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        TylerAudio::ParameterIDs::kLowCutSlope,
+        "Low Cut Slope",
+        slopeChoices,
+        0  // 12 dB/oct, the gentle slope of a tape machine's own low end
+    ));
+    
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        TylerAudio::ParameterIDs::kHighCutSlope,
+        "High Cut Slope",
+        slopeChoices,
+        0
+    ));
+
     // Bypass parameter
     layout.add(std::make_unique<juce::AudioParameterBool>(
         TylerAudio::ParameterIDs::kBypass,
@@ -414,228 +975,24 @@ juce::AudioProcessorValueTreeState::ParameterLayout TingeTapeAudioProcessor::cre
     return layout;
 }
 
-void TingeTapeAudioProcessor::parameterChanged(const juce::String& parameterID, float newValue)
-{
-    if (parameterID == TylerAudio::ParameterIDs::kWow)
-    {
-        wowSmoother.setTargetValue(newValue);
-    }
-    else if (parameterID == TylerAudio::ParameterIDs::kLowCutFreq)
-    {
-        lowCutFreqSmoother.setTargetValue(newValue);
-    }
-    else if (parameterID == TylerAudio::ParameterIDs::kLowCutRes)
-    {
-        lowCutResSmoother.setTargetValue(newValue);
-    }
-    else if (parameterID == TylerAudio::ParameterIDs::kHighCutFreq)
-    {
-        highCutFreqSmoother.setTargetValue(newValue);
-    }
-    else if (parameterID == TylerAudio::ParameterIDs::kHighCutRes)
-    {
-        highCutResSmoother.setTargetValue(newValue);
-    }
-    else if (parameterID == TylerAudio::ParameterIDs::kDirt)
-    {
-        dirtSmoother.setTargetValue(newValue);
-    }
-    else if (parameterID == TylerAudio::ParameterIDs::kTone)
-    {
-        toneSmoother.setTargetValue(newValue);
-    }
-    // Bypass is handled directly in processBlock via atomic load
-}
-
-// =============================================================================
-// DSP Class Implementations
-// =============================================================================
-
-// Wow Engine Implementation
-void TingeTapeAudioProcessor::WowEngine::prepare(double sampleRate, int maxBlockSize, int numChannels)
-{
-    this->sampleRate = static_cast<float>(sampleRate);
-    this->numChannels = numChannels;
-    
-    // Prepare delay lines for each channel
-    delayLines.resize(numChannels);
-    for (auto& delayLine : delayLines)
-    {
-        delayLine.setMaximumDelayInSamples(static_cast<int>(sampleRate * kMaxDelayMs / 1000.0f));
-        delayLine.prepare({sampleRate, static_cast<juce::uint32>(maxBlockSize), 1});
-    }
-    
-    // Prepare LFO - Research specification: 0.5Hz sine wave for authentic tape wow
-    lfo.prepare({sampleRate, static_cast<juce::uint32>(maxBlockSize), 1});
-    lfo.setFrequency(kWowFrequency);  // 0.5Hz fixed frequency per research
-    lfo.initialise([](float x) { return std::sin(x); }, 128);
-    
-    reset();
-}
-
-void TingeTapeAudioProcessor::WowEngine::setDepth(float depth) noexcept
-{
-    this->depth = juce::jlimit(0.0f, 100.0f, depth) / 100.0f;
-}
-
-float TingeTapeAudioProcessor::WowEngine::getNextSample(float input, int channel) noexcept
-{
-    if (depth <= 0.001f || channel >= numChannels)
-        return input;  // Bypass when depth is effectively zero or invalid channel
-    
-    // Generate LFO modulation (shared across channels for correlated wow)
-    const float lfoValue = lfo.processSample(0.0f);
-    
-    // Research-compliant delay calculation:
-    // modulatedDelayMs = baseDelayMs + (lfoOutput * depthParam * maxModulationMs)
-    constexpr float baseDelayMs = 5.0f;        // Fixed 5ms base delay per research
-    constexpr float maxModulationMs = 45.0f;   // 0-45ms modulation range per research
-    
-    // Calculate modulated delay in milliseconds
-    const float modulatedDelayMs = baseDelayMs + (lfoValue * depth * maxModulationMs);
-    
-    // Convert to samples
-    const float modulatedDelaySamples = modulatedDelayMs * sampleRate / 1000.0f;
-    
-    // Ensure delay is within valid range
-    const float maxDelaySamples = sampleRate * kMaxDelayMs / 1000.0f;
-    currentDelay = juce::jlimit(1.0f, maxDelaySamples - 1.0f, modulatedDelaySamples);
-    
-    // Set delay and get delayed sample for this channel
-    delayLines[channel].setDelay(currentDelay);
-    delayLines[channel].pushSample(0, input);
-    
-    return delayLines[channel].popSample(0);
-}
-
-void TingeTapeAudioProcessor::WowEngine::reset() noexcept
-{
-    for (auto& delayLine : delayLines)
-        delayLine.reset();
-    lfo.reset();
-    currentDelay = 0.0f;
-}
-
-// Tape Saturation Implementation
-void TingeTapeAudioProcessor::TapeSaturation::prepare(double sampleRate)
-{
-    juce::ignoreUnused(sampleRate);
-    reset();
-}
-
-void TingeTapeAudioProcessor::TapeSaturation::setDrive(float drive) noexcept
-{
-    this->drive = juce::jlimit(0.0f, 100.0f, drive) / 100.0f;
-}
-
-float TingeTapeAudioProcessor::TapeSaturation::processSample(float input) noexcept
-{
-    if (drive <= 0.001f)
-        return input;  // Bypass when drive is effectively zero
-    
-    // Research-compliant drive scaling: 1x to 10x gain (not 1x to 5x)
-    const float driveGain = 1.0f + (drive * 9.0f);  // drive is 0-1, maps to 1x-10x gain
-    
-    // Research-compliant tanh saturation with proper normalization
-    const float drivenInput = input * driveGain;
-    float sample = std::tanh(drivenInput);
-    
-    // Proper tanh normalization for unity gain: output = tanh(input * driveGain) / tanh(driveGain)
-    if (driveGain > 0.001f)
-    {
-        sample /= std::tanh(driveGain);
-    }
-    
-    // Drive-dependent high-frequency rolloff (more rolloff with more drive)
-    const float rolloffAmount = kHighFreqRolloff + (drive * 0.08f);  // Increase rolloff with drive
-    const float alpha = juce::jlimit(0.1f, 0.98f, rolloffAmount);
-    previousSample = alpha * previousSample + (1.0f - alpha) * sample;
-    sample = previousSample;
-    
-    // Improved level compensation to maintain consistent output levels
-    const float compensationFactor = 1.0f / (1.0f + drive * 0.5f);  // Gentle compensation
-    sample *= compensationFactor;
-    
-    // Denormal protection
-    if (std::fpclassify(sample) == FP_SUBNORMAL)
-        sample = 0.0f;
-    
-    return sample;
-}
-
-void TingeTapeAudioProcessor::TapeSaturation::reset() noexcept
-{
-    previousSample = 0.0f;
-}
-
-// Tone Control Implementation
-void TingeTapeAudioProcessor::ToneControl::prepare(double sampleRate)
-{
-    this->sampleRate = sampleRate;
-    
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = 512;  // Not critical for single-sample processing
-    spec.numChannels = 1;
-    
-    lowShelf.prepare(spec);
-    highShelf.prepare(spec);
-    
-    reset();
-    updateCoefficients();
-}
-
-void TingeTapeAudioProcessor::ToneControl::setTone(float tone) noexcept
-{
-    const float newTone = juce::jlimit(-100.0f, 100.0f, tone) / 100.0f;  // Normalize to -1.0 to +1.0
-    
-    if (std::abs(newTone - currentTone) > 0.001f)
-    {
-        currentTone = newTone;
-        updateCoefficients();
-    }
-}
-
-float TingeTapeAudioProcessor::ToneControl::processSample(float input) noexcept
-{
-    if (std::abs(currentTone) <= 0.001f)
-        return input;  // Bypass when tone is effectively zero
-    
-    // Process through both shelf filters
-    float sample = input;
-    sample = lowShelf.processSample(sample);
-    sample = highShelf.processSample(sample);
-    
-    return sample;
-}
-
-void TingeTapeAudioProcessor::ToneControl::reset() noexcept
-{
-    lowShelf.reset();
-    highShelf.reset();
-}
-
-void TingeTapeAudioProcessor::ToneControl::updateCoefficients()
-{
-    // Research-compliant shelf frequencies and gain range
-    constexpr float lowFreq = 250.0f;    // Low shelf frequency per research
-    constexpr float highFreq = 5000.0f;  // High shelf frequency per research  
-    constexpr float maxGainDb = 6.0f;    // Research-specified ±6dB range (was ±12dB)
-    
-    // Calculate gains for tilt filter effect
-    const float gainDb = currentTone * maxGainDb;
-    
-    // Low shelf: boost when tone is negative (darker), cut when positive (brighter)
-    const float lowGainDb = -gainDb;
-    auto lowCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-        sampleRate, lowFreq, 0.707f, juce::Decibels::decibelsToGain(lowGainDb));
-    *lowShelf.coefficients = *lowCoeffs;
-    
-    // High shelf: cut when tone is negative (darker), boost when positive (brighter)  
-    const float highGainDb = gainDb;
-    auto highCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-        sampleRate, highFreq, 0.707f, juce::Decibels::decibelsToGain(highGainDb));
-    *highShelf.coefficients = *highCoeffs;
+constexpr std::array<TingeTapeAudioProcessor::SmoothedParameter, 9> TingeTapeAudioProcessor::smoothedParameters
+{{
+    { &TingeTapeAudioProcessor::wowParameter, &TingeTapeAudioProcessor::wowSmoother },
+    { &TingeTapeAudioProcessor::flutterParameter, &TingeTapeAudioProcessor::flutterSmoother },
+    { &TingeTapeAudioProcessor::driftParameter, &TingeTapeAudioProcessor::driftSmoother },
+    { &TingeTapeAudioProcessor::lowCutFreqParameter, &TingeTapeAudioProcessor::lowCutFreqSmoother },
+    { &TingeTapeAudioProcessor::lowCutResParameter, &TingeTapeAudioProcessor::lowCutResSmoother },
+    { &TingeTapeAudioProcessor::highCutFreqParameter, &TingeTapeAudioProcessor::highCutFreqSmoother },
+    { &TingeTapeAudioProcessor::highCutResParameter, &TingeTapeAudioProcessor::highCutResSmoother },
+    { &TingeTapeAudioProcessor::dirtParameter, &TingeTapeAudioProcessor::dirtSmoother },
+    { &TingeTapeAudioProcessor::toneParameter, &TingeTapeAudioProcessor::toneSmoother }
+}};
+
+// Bypass and the cut filter slopes are read directly from their raw values in processBlock
+void TingeTapeAudioProcessor::updateSmootherTargets() noexcept
+{
+    for (const auto& parameter : smoothedParameters)
+        (this->*parameter.smoother).setTargetValue((this->*parameter.value)->load());
 }
 
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
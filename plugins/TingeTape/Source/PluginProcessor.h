@@ -2,9 +2,10 @@
 
 #include <JuceHeader.h>
 #include "TylerAudioCommon.h"
+#include "TingeTapeDSP.h"
+#include <array>
 
-class TingeTapeAudioProcessor : public juce::AudioProcessor,
-                                    public juce::AudioProcessorValueTreeState::Listener
+class TingeTapeAudioProcessor : public juce::AudioProcessor
 {
 public:
     TingeTapeAudioProcessor();
@@ -18,6 +19,8 @@ public:
 #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) noexcept override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) noexcept override;
+    bool supportsDoublePrecisionProcessing() const override { return true; }
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override;
@@ -42,22 +45,79 @@ public:
     [[nodiscard]] juce::AudioProcessorValueTreeState& getParameters() noexcept { return parameters; }
     [[nodiscard]] const juce::AudioProcessorValueTreeState& getParameters() const noexcept { return parameters; }
 
+    // Control rate for the smoothed dirt, tone and wow values. Internal only (not a host
+    // parameter) so the audio quality / CPU tradeoff can be benchmarked; safe to change
+    // from any thread, takes effect at the next processBlock.
+    void setControlRate(TylerAudio::TingeTape::ControlRate newRate) noexcept { controlRate.store(newRate); }
+    [[nodiscard]] TylerAudio::TingeTape::ControlRate getControlRate() const noexcept { return controlRate.load(); }
+
+    // Fractional delay interpolation of the wow stage. Internal only, like the control rate.
+    void setWowInterpolation(TylerAudio::TingeTape::DelayInterpolation newInterpolation) noexcept { wowInterpolation.store(newInterpolation); }
+    [[nodiscard]] TylerAudio::TingeTape::DelayInterpolation getWowInterpolation() const noexcept { return wowInterpolation.load(); }
+
+    // tanh kernel of the Dirt waveshaper, trading accuracy for CPU. Internal only, like the control rate.
+    void setSaturationKernel(TylerAudio::TingeTape::SaturationKernel newKernel) noexcept { saturationKernel.store(newKernel); }
+    [[nodiscard]] TylerAudio::TingeTape::SaturationKernel getSaturationKernel() const noexcept { return saturationKernel.load(); }
+
+    // Shape the Dirt stage with transfer tables shared by every instance in the process
+    // instead of the kernel. Internal only; takes effect at the next prepareToPlay.
+    void setSaturationTablesEnabled(bool shouldUseTables) noexcept { saturationTables.store(shouldUseTables); }
+    [[nodiscard]] bool areSaturationTablesEnabled() const noexcept { return saturationTables.load(); }
+
+    // Oversampling around the Dirt stage. Realtime playback and offline rendering keep
+    // separate factors, so a bounce can use a higher one than live playback; the latency
+    // of the factor in use is reported to the host. Saved with the plugin state; safe to
+    // change from any thread, takes effect at the next processBlock.
+    void setOversamplingFactor(TylerAudio::TingeTape::OversamplingFactor factor, bool forNonRealtime = false) noexcept;
+    [[nodiscard]] TylerAudio::TingeTape::OversamplingFactor getOversamplingFactor(bool forNonRealtime = false) const noexcept;
+    void setOversamplingFilter(TylerAudio::TingeTape::OversamplingFilter filter) noexcept { oversamplingFilter.store(filter); }
+    [[nodiscard]] TylerAudio::TingeTape::OversamplingFilter getOversamplingFilter() const noexcept { return oversamplingFilter.load(); }
+
+    // Antiderivative anti-aliasing of the Dirt stage: less aliasing with no added latency,
+    // so it can stay on while tracking. Saved with the plugin state; safe to change from
+    // any thread, takes effect at the next processBlock.
+    void setSaturationAntialiasing(TylerAudio::TingeTape::SaturationAntialiasing mode) noexcept { saturationAntialiasing.store(mode); }
+    [[nodiscard]] TylerAudio::TingeTape::SaturationAntialiasing getSaturationAntialiasing() const noexcept { return saturationAntialiasing.load(); }
+
+    // Jiles-Atherton hysteresis ("HQ") model for the Dirt stage. It runs at least 2x
+    // oversampled, raising the oversampling factor while active. Realtime playback and
+    // offline rendering keep separate solvers, so a bounce can use a more exact one than
+    // live playback. Saved with the plugin state; safe to change from any thread, takes
+    // effect at the next processBlock.
+    void setSaturationModel(TylerAudio::TingeTape::SaturationModel newModel) noexcept { saturationModel.store(newModel); }
+    [[nodiscard]] TylerAudio::TingeTape::SaturationModel getSaturationModel() const noexcept { return saturationModel.load(); }
+    void setHysteresisSolver(TylerAudio::TingeTape::HysteresisSolver solver, bool forNonRealtime = false) noexcept;
+    [[nodiscard]] TylerAudio::TingeTape::HysteresisSolver getHysteresisSolver(bool forNonRealtime = false) const noexcept;
+
+    // Structure of the low-cut and high-cut filters. State-variable filters follow cutoff
+    // and resonance automation every sample instead of stepping once per block, for a
+    // little more CPU. Saved with the plugin state; safe to change from any thread, takes
+    // effect at the next processBlock.
+    void setCutFilterTopology(TylerAudio::TingeTape::CutFilterTopology topology) noexcept { cutFilterTopology.store(topology); }
+    [[nodiscard]] TylerAudio::TingeTape::CutFilterTopology getCutFilterTopology() const noexcept { return cutFilterTopology.load(); }
+
 private:
     // Parameter tree state for thread-safe parameter management
     juce::AudioProcessorValueTreeState parameters;
     
     // Realtime-safe parameter access for all tape emulation parameters
     std::atomic<float>* wowParameter{nullptr};
+    std::atomic<float>* flutterParameter{nullptr};
+    std::atomic<float>* driftParameter{nullptr};
     std::atomic<float>* lowCutFreqParameter{nullptr};
     std::atomic<float>* lowCutResParameter{nullptr};
     std::atomic<float>* highCutFreqParameter{nullptr};
     std::atomic<float>* highCutResParameter{nullptr};
+    std::atomic<float>* lowCutSlopeParameter{nullptr};
+    std::atomic<float>* highCutSlopeParameter{nullptr};
     std::atomic<float>* dirtParameter{nullptr};
     std::atomic<float>* toneParameter{nullptr};
     std::atomic<float>* bypassParameter{nullptr};
     
     // Parameter smoothing for all parameters
     TylerAudio::Utils::SmoothingFilter wowSmoother;
+    TylerAudio::Utils::SmoothingFilter flutterSmoother;
+    TylerAudio::Utils::SmoothingFilter driftSmoother;
     TylerAudio::Utils::SmoothingFilter lowCutFreqSmoother;
     TylerAudio::Utils::SmoothingFilter lowCutResSmoother;
     TylerAudio::Utils::SmoothingFilter highCutFreqSmoother;
@@ -65,84 +125,141 @@ private:
     TylerAudio::Utils::SmoothingFilter dirtSmoother;
     TylerAudio::Utils::SmoothingFilter toneSmoother;
     
-    // DSP Components
+    // Control-rate rendering of the dirt, tone and transport modulation smoothers
+    std::atomic<TylerAudio::TingeTape::ControlRate> controlRate{TylerAudio::TingeTape::ControlRate::every16Samples};
+    int controlInterval{1};
+    TylerAudio::TingeTape::ControlRamp dirtRamp;
+    TylerAudio::TingeTape::ControlRamp toneRamp;
+    TylerAudio::TingeTape::ControlRamp wowRamp;
+    TylerAudio::TingeTape::ControlRamp flutterRamp;
+    TylerAudio::TingeTape::ControlRamp driftRamp;
     
-    // Wow modulation engine
-    class WowEngine
-    {
-    public:
-        void prepare(double sampleRate, int maxBlockSize, int numChannels = 2);
-        void setDepth(float depth) noexcept;
-        float getNextSample(float input, int channel) noexcept;
-        void reset() noexcept;
-        
-    private:
-        static constexpr float kWowFrequency = 0.5f;  // Hz
-        static constexpr int kMaxDelayMs = 50;        // Maximum delay for pitch modulation
-        
-        std::vector<juce::dsp::DelayLine<float>> delayLines;
-        juce::dsp::Oscillator<float> lfo;
-        float depth{0.0f};
-        float sampleRate{44100.0f};
-        float currentDelay{0.0f};
-        int numChannels{2};
-    };
+    // The cut filter smoothers are only rendered per sample for the state-variable filters;
+    // the biquads take one value per block
+    TylerAudio::TingeTape::ControlRamp lowCutFreqRamp;
+    TylerAudio::TingeTape::ControlRamp lowCutResRamp;
+    TylerAudio::TingeTape::ControlRamp highCutFreqRamp;
+    TylerAudio::TingeTape::ControlRamp highCutResRamp;
+    std::atomic<TylerAudio::TingeTape::CutFilterTopology> cutFilterTopology{TylerAudio::TingeTape::CutFilterTopology::biquad};
+    TylerAudio::TingeTape::CutFilterTopology activeCutFilterTopology{TylerAudio::TingeTape::CutFilterTopology::biquad};
     
-    // Resonant filter pair
-    using FilterType = juce::dsp::IIR::Filter<float>;
-    using Coefficients = juce::dsp::IIR::Coefficients<float>;
+    std::atomic<TylerAudio::TingeTape::DelayInterpolation> wowInterpolation{TylerAudio::TingeTape::DelayInterpolation::linear};
+    std::atomic<TylerAudio::TingeTape::SaturationKernel> saturationKernel{TylerAudio::TingeTape::SaturationKernel::fastMath};
+    std::atomic<bool> saturationTables{false};
     
-    juce::dsp::ProcessorDuplicator<FilterType, Coefficients> lowCutFilter;
-    juce::dsp::ProcessorDuplicator<FilterType, Coefficients> highCutFilter;
+    // Dirt stage oversampling as requested, and as currently applied to both chains
+    std::atomic<TylerAudio::TingeTape::OversamplingFactor> realtimeOversampling{TylerAudio::TingeTape::OversamplingFactor::x1};
+    std::atomic<TylerAudio::TingeTape::OversamplingFactor> offlineOversampling{TylerAudio::TingeTape::OversamplingFactor::x1};
+    std::atomic<TylerAudio::TingeTape::OversamplingFilter> oversamplingFilter{TylerAudio::TingeTape::OversamplingFilter::polyphaseIIR};
+    TylerAudio::TingeTape::OversamplingFactor activeOversamplingFactor{TylerAudio::TingeTape::OversamplingFactor::x1};
+    TylerAudio::TingeTape::OversamplingFilter activeOversamplingFilter{TylerAudio::TingeTape::OversamplingFilter::polyphaseIIR};
+    std::atomic<TylerAudio::TingeTape::SaturationAntialiasing> saturationAntialiasing{TylerAudio::TingeTape::SaturationAntialiasing::none};
+    std::atomic<TylerAudio::TingeTape::SaturationModel> saturationModel{TylerAudio::TingeTape::SaturationModel::tanh};
+    std::atomic<TylerAudio::TingeTape::HysteresisSolver> realtimeHysteresisSolver{TylerAudio::TingeTape::HysteresisSolver::rk2};
+    std::atomic<TylerAudio::TingeTape::HysteresisSolver> offlineHysteresisSolver{TylerAudio::TingeTape::HysteresisSolver::rk4};
     
-    // Tape saturation processor
-    class TapeSaturation
+    // DSP Components, one chain per sample precision. Both are prepared so the host can
+    // switch precision without a reallocation; parameters, smoothing and control buffers
+    // are shared.
+    template <typename SampleType>
+    struct ProcessingChain
     {
-    public:
-        void prepare(double sampleRate);
-        void setDrive(float drive) noexcept;
-        float processSample(float input) noexcept;
-        void reset() noexcept;
+        // The resonant cut filters are the tone control's fixed sections, so low-cut, tone
+        // and high-cut run in one SIMD filter kernel wherever they are next to each other:
+        // one section per 12 dB/oct of slope, the low-cut's first and the high-cut's right
+        // after. The state-variable pair replaces them when that topology is selected.
+        int numLowCutSections{1};
+        int numHighCutSections{1};
+        TylerAudio::TingeTape::SIMDStateVariableFilter<SampleType> lowCutStateVariable;
+        TylerAudio::TingeTape::SIMDStateVariableFilter<SampleType> highCutStateVariable;
         
-    private:
-        float drive{0.0f};
-        float previousSample{0.0f};  // For drive-dependent HF rolloff filter
+        // DSP instances
+        TylerAudio::TingeTape::WowEngine<SampleType> wowEngine;
+        TylerAudio::TingeTape::TapeSaturation<SampleType> tapeSaturation;
+        TylerAudio::TingeTape::ToneControl<SampleType> toneControl;
         
-        // Research-compliant constants
-        static constexpr float kHighFreqRolloff = 0.9f;  // Base rolloff, increases with drive
-    };
-    
-    // Tone control (tilt filter)
-    class ToneControl
-    {
-    public:
-        void prepare(double sampleRate);
-        void setTone(float tone) noexcept;  // -1.0 to +1.0
-        float processSample(float input) noexcept;
-        void reset() noexcept;
-        
-    private:
-        juce::dsp::IIR::Filter<float> lowShelf;
-        juce::dsp::IIR::Filter<float> highShelf;
-        float currentTone{0.0f};
-        double sampleRate{44100.0};
+        // Per-block bypass of the dirt and wow stages while they are neutral. The tone
+        // shelves need no crossfade: they drop out at the neutral design and come back in
+        // from it, ramping like any other tone change.
+        TylerAudio::TingeTape::StageSwitch<SampleType> dirtSwitch;
+        TylerAudio::TingeTape::StageSwitch<SampleType> wowSwitch;
+        bool toneActive{false};
         
-        void updateCoefficients();
+        void prepare(double sampleRate, int maxBlockSize, int numChannels);
+        void reset() noexcept;
+        void setControlInterval(int numSamples) noexcept;
+        void resetCutFilters() noexcept;
+        void setCutFilterSlopes(int newNumLowCutSections, int newNumHighCutSections) noexcept;
     };
     
-    // DSP instances
-    WowEngine wowEngine;
-    TapeSaturation tapeSaturation;
-    ToneControl toneControl;
+    ProcessingChain<float> floatChain;
+    ProcessingChain<double> doubleChain;
+    
+    // Per-sample smoothed parameter values, rendered once per sub-block and consumed
+    // by the block stages. Host blocks larger than maxSubBlockSize are split.
+    std::vector<float> dirtControlBuffer;
+    std::vector<float> toneControlBuffer;
+    std::vector<float> wowControlBuffer;
+    std::vector<float> flutterControlBuffer;
+    std::vector<float> driftControlBuffer;
+    std::vector<float> lowCutFreqControlBuffer;
+    std::vector<float> lowCutResControlBuffer;
+    std::vector<float> highCutFreqControlBuffer;
+    std::vector<float> highCutResControlBuffer;
+    int maxSubBlockSize{0};
+    int numPreparedChannels{0};
+    double currentSampleRate{44100.0};
+    
+    // Cut filter coefficients precomputed at the current sample rate, shared with every
+    // other instance running at it
+    juce::SharedResourcePointer<TylerAudio::TingeTape::CutFilterTableCache> cutFilterTableCache;
+    std::shared_ptr<const TylerAudio::TingeTape::CutFilterTables> cutFilterTables;
+    
+    // Idle fast path: once the input has been silent for longer than the chain's tail,
+    // processing is skipped and silence is output until signal returns
+    static constexpr float kSilenceThreshold = 1.0e-5f;  // -100 dBFS
+    static constexpr double kTailDecayDb = 100.0;        // Tail ends once decayed to the silence threshold
+    int silentSamples{0};
+    bool isIdle{false};
     
     // Create parameter layout
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
-    // AudioProcessorValueTreeState::Listener interface
-    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    // Routes a raw parameter value to its smoother's target. The table of these is
+    // polled once per block, so automation costs a load per parameter however dense it is.
+    struct SmoothedParameter
+    {
+        std::atomic<float>* TingeTapeAudioProcessor::* value;
+        TylerAudio::Utils::SmoothingFilter TingeTapeAudioProcessor::* smoother;
+    };
+    
+    static const std::array<SmoothedParameter, 9> smoothedParameters;
+    void updateSmootherTargets() noexcept;
     
     // Helper methods
-    void updateFilters();
+    template <typename SampleType>
+    void updateFilters(ProcessingChain<SampleType>& chain) noexcept;
+    void updateControlInterval() noexcept;
+    void updateOversampling() noexcept;
+    void applyOversampling() noexcept;
+    void updateCutFilterTopology() noexcept;
+    template <typename SampleType>
+    void updateCutFilterSlopes(ProcessingChain<SampleType>& chain) noexcept;
+    [[nodiscard]] static int getNumCutFilterSections(const std::atomic<float>& slopeParameter) noexcept;
+    [[nodiscard]] TylerAudio::TingeTape::OversamplingFactor getRequiredOversamplingFactor() const noexcept;
+    void enterIdleState() noexcept;
+    void resetStageSwitches() noexcept;
+    [[nodiscard]] static bool isStageNeeded(const TylerAudio::Utils::SmoothingFilter& smoother) noexcept;
+    [[nodiscard]] bool isDirtStageNeeded() const noexcept;
+    [[nodiscard]] bool isWowStageNeeded() const noexcept;
+    template <typename SampleType>
+    [[nodiscard]] bool isInputSilent(const juce::dsp::AudioBlock<SampleType>& block) const noexcept;
+    [[nodiscard]] double calculateTailLengthSeconds(float lowCutFreq, float lowCutRes,
+                                                    float highCutFreq, float highCutRes) const noexcept;
+    template <typename SampleType>
+    void processBlockWithChain(juce::AudioBuffer<SampleType>& buffer, ProcessingChain<SampleType>& chain) noexcept;
+    template <typename SampleType>
+    void processSubBlock(juce::dsp::AudioBlock<SampleType>& block, ProcessingChain<SampleType>& chain) noexcept;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TingeTapeAudioProcessor)
 };
\ No newline at end of file
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "TylerAudioCommon.h"
+#include "BiquadDesign.h"
+#include "SIMDLanes.h"
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace TylerAudio::TingeTape
+{
+    // Cascade of up to kMaxSections biquads (transposed direct form II) that processes
+    // channels as SIMD lanes. Each group of Register::size() channels (4 floats on SSE2/NEON,
+    // 8 on AVX2) is copied into an interleaved scratch once (see SIMDLaneScratch) and runs
+    // through every section there: up to kMaxFusedSections at a time in one pass, and
+    // longer cascades in further passes while the scratch is still in cache, so each extra
+    // section costs its arithmetic and little else. Coefficients are shared by all channels
+    // and written in place with the BiquadDesign calculators, so nothing here allocates
+    // after prepare(). processRamped() moves them to new values sample by sample instead of
+    // in one step, and a run of neighbouring sections can be processed on its own when a
+    // cascade has to be split around another stage.
+    template <typename SampleType>
+    class SIMDBiquadCascade
+    {
+    public:
+        using Register = juce::dsp::SIMDRegister<SampleType>;
+        using Scratch = SIMDLaneScratch<SampleType>;
+        using SectionCoefficients = std::array<SampleType, static_cast<size_t>(BiquadDesign::kNumCoefficients)>;
+
+        static constexpr int kNumLanes = Scratch::kNumLanes;
+        static constexpr int kMaxSections = 10;
+        static constexpr int kMaxFusedSections = 4;  // Sections per pass before their state spills out of registers
+
+        void prepare(int maxBlockSize, int numChannels, int numSections = 1)
+        {
+            jassert(numChannels > 0 && numChannels <= kMaxChannels);
+            jassert(numSections > 0 && numSections <= kMaxSections);
+
+            this->maxBlockSize = juce::jmax(1, maxBlockSize);
+            this->numChannels = juce::jlimit(1, kMaxChannels, numChannels);
+            this->numSections = juce::jlimit(1, kMaxSections, numSections);
+            numLaneGroups = Scratch::getNumLaneGroups(this->numChannels);
+
+            state.resize(static_cast<size_t>(numLaneGroups * kMaxSections));
+            scratch.prepare(this->maxBlockSize);
+
+            // Start as a pass-through until the owner writes real coefficients
+            for (auto& section : coefficients)
+                section = {SampleType(1), SampleType(0), SampleType(0), SampleType(0), SampleType(0)};
+
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            reset(0, kMaxSections);
+        }
+
+        // Clears count sections from firstSection on and leaves the others ringing
+        void reset(int firstSection, int count) noexcept
+        {
+            jassert(firstSection >= 0 && firstSection + count <= kMaxSections);
+
+            for (int group = 0; group < numLaneGroups; ++group)
+            {
+                for (int section = firstSection; section < firstSection + count; ++section)
+                {
+                    auto& sectionState = state[static_cast<size_t>(group * kMaxSections + section)];
+                    sectionState.s1 = Register::expand(SampleType(0));
+                    sectionState.s2 = Register::expand(SampleType(0));
+                }
+            }
+        }
+
+        // Storage for a section's normalised {b0, b1, b2, a1, a2}
+        [[nodiscard]] SampleType* getCoefficients(int section) noexcept
+        {
+            jassert(juce::isPositiveAndBelow(section, kMaxSections));
+            return coefficients[static_cast<size_t>(section)].data();
+        }
+
+        [[nodiscard]] int getNumSections() const noexcept { return numSections; }
+
+        // Changes how many sections process() runs, up to kMaxSections; sections coming into
+        // use keep whatever coefficients and state they last had
+        void setNumSections(int newNumSections) noexcept
+        {
+            jassert(newNumSections > 0 && newNumSections <= kMaxSections);
+            numSections = juce::jlimit(1, kMaxSections, newNumSections);
+        }
+
+        // Moves count sections' coefficients and state from firstSection to destination, as
+        // std::copy would with overlapping ranges handled
+        void moveSections(int firstSection, int destination, int count) noexcept
+        {
+            jassert(firstSection >= 0 && destination >= 0 && count >= 0);
+            jassert(firstSection + count <= kMaxSections && destination + count <= kMaxSections);
+
+            auto move = [&](auto* base)
+            {
+                if (destination < firstSection)
+                    std::copy(base + firstSection, base + firstSection + count, base + destination);
+                else
+                    std::copy_backward(base + firstSection, base + firstSection + count, base + destination + count);
+            };
+
+            move(coefficients.data());
+
+            for (int group = 0; group < numLaneGroups; ++group)
+                move(state.data() + group * kMaxSections);
+        }
+
+        void process(juce::dsp::AudioBlock<SampleType>& block) noexcept
+        {
+            process(block, 0, numSections);
+        }
+
+        // Runs count neighbouring sections from firstSection only, e.g. either side of a
+        // nonlinear stage that splits the cascade
+        void process(juce::dsp::AudioBlock<SampleType>& block, int firstSection, int count) noexcept
+        {
+            dispatch<false>(block, firstSection, count, nullptr, 0, 0);
+        }
+
+        // Processes the block as back-to-back ramps: the first lasts firstRampLength samples,
+        // the rest rampLength, and the block end may cut the last one short. Over ramp r the
+        // coefficients of each section run move in a straight line to targets[r * count + i]
+        // for section firstSection + i, arriving on the ramp's last sample. Costs the same
+        // however far they move, and nothing extra for sections whose target is unchanged.
+        void processRamped(juce::dsp::AudioBlock<SampleType>& block, const SectionCoefficients* targets,
+                           int firstRampLength, int rampLength) noexcept
+        {
+            processRamped(block, 0, numSections, targets, firstRampLength, rampLength);
+        }
+
+        void processRamped(juce::dsp::AudioBlock<SampleType>& block, int firstSection, int count,
+                           const SectionCoefficients* targets, int firstRampLength, int rampLength) noexcept
+        {
+            jassert(firstRampLength > 0 && rampLength > 0);
+            dispatch<true>(block, firstSection, count, targets, firstRampLength, rampLength);
+        }
+
+    private:
+        struct SectionState
+        {
+            Register s1;
+            Register s2;
+        };
+
+        using SectionRegisters = std::array<Register, static_cast<size_t>(BiquadDesign::kNumCoefficients)>;
+
+        template <bool Ramped>
+        void dispatch(juce::dsp::AudioBlock<SampleType>& block, int firstSection, int count,
+                      const SectionCoefficients* targets, int firstRampLength, int rampLength) noexcept
+        {
+            jassert(firstSection >= 0 && count >= 0 && firstSection + count <= numSections);
+
+            const auto numSamples = static_cast<int>(block.getNumSamples());
+            const auto channelsToProcess = juce::jmin(numChannels, static_cast<int>(block.getNumChannels()));
+            jassert(numSamples <= maxBlockSize);
+
+            if (numSamples == 0 || count == 0)
+                return;
+
+            for (int group = 0; group < numLaneGroups; ++group)
+            {
+                const int firstChannel = group * kNumLanes;
+                const int numLanesUsed = juce::jmin(kNumLanes, channelsToProcess - firstChannel);
+
+                if (numLanesUsed <= 0)
+                    break;
+
+                scratch.interleave(block, firstChannel, numLanesUsed, numSamples);
+                auto* groupState = state.data() + group * kMaxSections;
+
+                for (int chunk = 0; chunk < count; chunk += kMaxFusedSections)
+                {
+                    const auto* chunkTargets = Ramped ? targets + chunk : nullptr;
+                    const int section = firstSection + chunk;
+
+                    switch (juce::jmin(kMaxFusedSections, count - chunk))
+                    {
+                        case 1:  processSections<1, Ramped>(numSamples, section, groupState, chunkTargets, count, firstRampLength, rampLength); break;
+                        case 2:  processSections<2, Ramped>(numSamples, section, groupState, chunkTargets, count, firstRampLength, rampLength); break;
+                        case 3:  processSections<3, Ramped>(numSamples, section, groupState, chunkTargets, count, firstRampLength, rampLength); break;
+                        default: processSections<4, Ramped>(numSamples, section, groupState, chunkTargets, count, firstRampLength, rampLength); break;
+                    }
+                }
+
+                scratch.deinterleave(block, firstChannel, numLanesUsed, numSamples);
+            }
+
+            if constexpr (Ramped)
+            {
+                // The sections keep the last ramp's targets
+                int lastRamp = 0;
+
+                for (int end = firstRampLength; end < numSamples; end += rampLength)
+                    ++lastRamp;
+
+                const auto* finalCoefficients = targets + lastRamp * count;
+                std::copy(finalCoefficients, finalCoefficients + count, coefficients.data() + firstSection);
+            }
+        }
+
+        // Runs one section over frames [start, end) of the scratch, stepping its coefficients
+        // once per sample when Ramped
+        template <bool Ramped>
+        void processSection(int start, int end, SectionRegisters k, const SectionRegisters& steps,
+                            Register& s1, Register& s2) noexcept
+        {
+            for (int i = start; i < end; ++i)
+            {
+                auto* frame = scratch.getFrame(i);
+                const auto x = Register::fromRawArray(frame);
+
+                if constexpr (Ramped)
+                    for (size_t n = 0; n < static_cast<size_t>(BiquadDesign::kNumCoefficients); ++n)
+                        k[n] += steps[n];
+
+                const auto y = k[0] * x + s1;
+                s1 = k[1] * x - k[3] * y + s2;
+                s2 = k[2] * x - k[4] * y;
+                y.copyToRawArray(frame);
+            }
+        }
+
+        // Runs NumSections sections from firstSection over the interleaved scratch. When
+        // Ramped, ramp r moves them to targets[r * targetStride + i].
+        template <size_t NumSections, bool Ramped>
+        void processSections(int numSamples, int firstSection, SectionState* groupState, const SectionCoefficients* targets,
+                             int targetStride, int firstRampLength, int rampLength) noexcept
+        {
+            auto* sectionState = groupState + firstSection;
+            std::array<Register, NumSections> s1;
+            std::array<Register, NumSections> s2;
+
+            for (size_t section = 0; section < NumSections; ++section)
+            {
+                s1[section] = sectionState[section].s1;
+                s2[section] = sectionState[section].s2;
+            }
+
+            // Without ramps the whole block is one run with fixed coefficients
+            const SectionCoefficients* from = coefficients.data() + firstSection;
+            const SectionCoefficients* to = Ramped ? targets : from;
+            int start = 0;
+            int end = Ramped ? juce::jmin(firstRampLength, numSamples) : numSamples;
+
+            while (start < numSamples)
+            {
+                if constexpr (Ramped)
+                {
+                    // Ramping needs twice the registers, so run the sections one after
+                    // another over the ramp rather than spill them
+                    for (size_t section = 0; section < NumSections; ++section)
+                    {
+                        SectionRegisters k;
+                        SectionRegisters steps;
+                        const bool moving = to[section] != from[section];
+
+                        for (size_t n = 0; n < static_cast<size_t>(BiquadDesign::kNumCoefficients); ++n)
+                        {
+                            k[n] = Register::expand(from[section][n]);
+                            steps[n] = Register::expand((to[section][n] - from[section][n]) / static_cast<SampleType>(end - start));
+                        }
+
+                        if (moving)
+                            processSection<true>(start, end, k, steps, s1[section], s2[section]);
+                        else
+                            processSection<false>(start, end, k, steps, s1[section], s2[section]);
+                    }
+                }
+                else
+                {
+                    // Broadcast the shared coefficients once per call
+                    std::array<SectionRegisters, NumSections> c;
+                    for (size_t section = 0; section < NumSections; ++section)
+                        for (size_t n = 0; n < static_cast<size_t>(BiquadDesign::kNumCoefficients); ++n)
+                            c[section][n] = Register::expand(from[section][n]);
+
+                    for (int i = start; i < end; ++i)
+                    {
+                        auto* frame = scratch.getFrame(i);
+                        auto x = Register::fromRawArray(frame);
+
+                        for (size_t section = 0; section < NumSections; ++section)
+                        {
+                            const auto& k = c[section];
+                            const auto y = k[0] * x + s1[section];
+                            s1[section] = k[1] * x - k[3] * y + s2[section];
+                            s2[section] = k[2] * x - k[4] * y;
+                            x = y;
+                        }
+
+                        x.copyToRawArray(frame);
+                    }
+                }
+
+                // Each ramp starts exactly on the last one's targets, so rounding never accumulates
+                from = to;
+                to += Ramped ? targetStride : 0;
+                start = end;
+                end = juce::jmin(end + rampLength, numSamples);
+            }
+
+            for (size_t section = 0; section < NumSections; ++section)
+            {
+                sectionState[section].s1 = Scratch::snapToZero(s1[section]);
+                sectionState[section].s2 = Scratch::snapToZero(s2[section]);
+            }
+        }
+
+        std::array<SectionCoefficients, static_cast<size_t>(kMaxSections)> coefficients{};
+        std::vector<SectionState> state;
+        Scratch scratch;
+        int maxBlockSize{0};
+        int numChannels{0};
+        int numSections{1};
+        int numLaneGroups{0};
+    };
+}
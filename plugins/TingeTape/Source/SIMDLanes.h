@@ -0,0 +1,97 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "TylerAudioCommon.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#if ! JUCE_USE_SIMD
+    #error "TingeTape's SIMD kernels require juce::dsp::SIMDRegister support"
+#endif
+
+namespace TylerAudio::TingeTape
+{
+    // Widest bus TingeTape accepts, e.g. 7.1.4 or 9.1.6 stems, in any named or discrete
+    // layout. The SIMD filters size their lane groups for it.
+    constexpr int kMaxChannels = 16;
+
+    // Frame-major scratch for running channels as SIMD lanes. A group of Register::size()
+    // channels is copied in, processed one register per sample frame, and copied back.
+    template <typename SampleType>
+    class SIMDLaneScratch
+    {
+    public:
+        using Register = juce::dsp::SIMDRegister<SampleType>;
+
+        static constexpr int kNumLanes = static_cast<int>(Register::size());
+
+        [[nodiscard]] static int getNumLaneGroups(int numChannels) noexcept { return (numChannels + kNumLanes - 1) / kNumLanes; }
+
+        void prepare(int maxBlockSize)
+        {
+            // One spare frame so the frames can be aligned to the register size
+            storage.assign(static_cast<size_t>((juce::jmax(1, maxBlockSize) + 1) * kNumLanes), SampleType(0));
+            frames = alignToRegister(storage.data());
+        }
+
+        [[nodiscard]] SampleType* getFrame(int index) noexcept { return frames + index * kNumLanes; }
+
+        // Copies a lane group's channels in; unused lanes are zeroed. Both copies go frame by
+        // frame, so each frame is written in one go rather than in a strided pass per lane.
+        void interleave(const juce::dsp::AudioBlock<SampleType>& block, int firstChannel,
+                        int numLanesUsed, int numSamples) noexcept
+        {
+            std::array<const SampleType*, static_cast<size_t>(kNumLanes)> sources{};
+
+            for (int lane = 0; lane < numLanesUsed; ++lane)
+                sources[static_cast<size_t>(lane)] = block.getChannelPointer(static_cast<size_t>(firstChannel + lane));
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                auto* frame = getFrame(i);
+
+                for (int lane = 0; lane < kNumLanes; ++lane)
+                    frame[lane] = lane < numLanesUsed ? sources[static_cast<size_t>(lane)][i] : SampleType(0);
+            }
+        }
+
+        void deinterleave(juce::dsp::AudioBlock<SampleType>& block, int firstChannel,
+                          int numLanesUsed, int numSamples) const noexcept
+        {
+            std::array<SampleType*, static_cast<size_t>(kNumLanes)> destinations{};
+
+            for (int lane = 0; lane < numLanesUsed; ++lane)
+                destinations[static_cast<size_t>(lane)] = block.getChannelPointer(static_cast<size_t>(firstChannel + lane));
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const auto* frame = frames + i * kNumLanes;
+
+                for (int lane = 0; lane < numLanesUsed; ++lane)
+                    destinations[static_cast<size_t>(lane)][i] = frame[lane];
+            }
+        }
+
+        // Flushes lanes that have decayed into the denormal range
+        [[nodiscard]] static Register snapToZero(Register value) noexcept
+        {
+            for (size_t lane = 0; lane < Register::size(); ++lane)
+                if (std::abs(value.get(lane)) < static_cast<SampleType>(Constants::kDenormalThreshold))
+                    value.set(lane, SampleType(0));
+
+            return value;
+        }
+
+    private:
+        static SampleType* alignToRegister(SampleType* ptr) noexcept
+        {
+            constexpr auto alignment = static_cast<std::uintptr_t>(Register::SIMDRegisterSize);
+            const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+            return reinterpret_cast<SampleType*>((address + alignment - 1) & ~(alignment - 1));
+        }
+
+        std::vector<SampleType> storage;
+        SampleType* frames{nullptr};
+    };
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "TylerAudioCommon.h"
+#include "BiquadDesign.h"
+#include "SIMDLanes.h"
+#include <array>
+#include <vector>
+
+namespace TylerAudio::TingeTape
+{
+    // Topology-preserving-transform state-variable filter (Zavalishin's trapezoidal SVF)
+    // that processes channels as SIMD lanes, like SIMDBiquadCascade. Its state is the
+    // integrators' own, so the cutoff and resonance can change every sample without the
+    // transients a biquad's state gives when its coefficients jump. The per-sample
+    // coefficients are shared by all channels and computed once per block in a loop with
+    // no trig: the bilinear prewarp tan() is replaced by a rational approximation. Steeper
+    // slopes cascade up to kMaxStages filters with Butterworth Qs in the same pass, the
+    // resonance setting the last one's as in BiquadDesign::resonantSectionQ().
+    template <typename SampleType>
+    class SIMDStateVariableFilter
+    {
+    public:
+        using Register = juce::dsp::SIMDRegister<SampleType>;
+        using Scratch = SIMDLaneScratch<SampleType>;
+
+        static constexpr int kNumLanes = Scratch::kNumLanes;
+        static constexpr int kMaxStages = BiquadDesign::kMaxCascadeSections;
+
+        enum class Type
+        {
+            lowPass,
+            highPass
+        };
+
+        void prepare(double sampleRate, int maxBlockSize, int numChannels, Type type)
+        {
+            jassert(sampleRate > 0.0);
+            jassert(numChannels > 0 && numChannels <= kMaxChannels);
+
+            this->sampleRate = sampleRate;
+            this->type = type;
+            this->maxBlockSize = juce::jmax(1, maxBlockSize);
+            this->numChannels = juce::jlimit(1, kMaxChannels, numChannels);
+            numLaneGroups = Scratch::getNumLaneGroups(this->numChannels);
+
+            const auto blockSize = static_cast<size_t>(this->maxBlockSize);
+            g.assign(blockSize, SampleType(0));
+
+            for (auto& stage : stages)
+            {
+                stage.a1.assign(blockSize, SampleType(0));
+                stage.a2.assign(blockSize, SampleType(0));
+                stage.a3.assign(blockSize, SampleType(0));
+                stage.damping.assign(blockSize, SampleType(0));
+            }
+
+            state.resize(static_cast<size_t>(numLaneGroups * kMaxStages));
+            scratch.prepare(this->maxBlockSize);
+
+            setNumStages(numStages);
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            reset(0, kMaxStages);
+        }
+
+        // Clears count stages from firstStage on and leaves the others ringing
+        void reset(int firstStage, int count) noexcept
+        {
+            for (int group = 0; group < numLaneGroups; ++group)
+            {
+                for (int stage = firstStage; stage < firstStage + count; ++stage)
+                {
+                    auto& laneState = state[static_cast<size_t>(group * kMaxStages + stage)];
+                    laneState.ic1 = Register::expand(SampleType(0));
+                    laneState.ic2 = Register::expand(SampleType(0));
+                }
+            }
+        }
+
+        // 12 dB/oct per stage. Stages already running keep their state, and new ones start
+        // from silence.
+        void setNumStages(int newNumStages) noexcept
+        {
+            jassert(newNumStages > 0 && newNumStages <= kMaxStages);
+            newNumStages = juce::jlimit(1, kMaxStages, newNumStages);
+
+            if (newNumStages > numStages)
+                reset(numStages, newNumStages - numStages);
+
+            numStages = newNumStages;
+
+            // Damping is 1 / Q: fixed for all but the last stage, whose Q scales with resonance
+            for (int stage = 0; stage < numStages; ++stage)
+                stageDamping[static_cast<size_t>(stage)] = static_cast<SampleType>(1.0 / BiquadDesign::resonantSectionQ(numStages, stage, 1.0));
+        }
+
+        [[nodiscard]] int getNumStages() const noexcept { return numStages; }
+
+        // tan(angle) for angles in [0, pi / 2), from its [5/4] Pade approximant: within
+        // 0.003% of tan() up to 0.45 of the sample rate and 0.03% at the 0.49 limit
+        [[nodiscard]] static SampleType prewarp(SampleType angle) noexcept
+        {
+            const auto x2 = angle * angle;
+            return angle * (SampleType(945) - x2 * (SampleType(105) - x2))
+                   / (SampleType(945) - x2 * (SampleType(420) - x2 * SampleType(15)));
+        }
+
+        // cutoff (Hz) and resonance (Q) hold one value per sample of the block
+        void process(juce::dsp::AudioBlock<SampleType>& block, const float* cutoff, const float* resonance) noexcept
+        {
+            const auto numSamples = static_cast<int>(block.getNumSamples());
+            const auto channelsToProcess = juce::jmin(numChannels, static_cast<int>(block.getNumChannels()));
+            jassert(numSamples <= maxBlockSize);
+
+            if (numSamples == 0)
+                return;
+
+            // g = tan(pi * fc / fs) per sample, then each stage's coefficients from it and its
+            // k = 1 / Q; branch-free so the compiler can vectorise them
+            const auto maxCutoff = static_cast<float>(sampleRate * kMaxCutoffRatio);
+            const auto angleScale = juce::MathConstants<SampleType>::pi / static_cast<SampleType>(sampleRate);
+            const auto lastStage = static_cast<size_t>(numStages - 1);
+            auto* gValues = g.data();
+
+            for (int i = 0; i < numSamples; ++i)
+                gValues[i] = prewarp(angleScale * static_cast<SampleType>(juce::jlimit(kMinCutoff, maxCutoff, cutoff[i])));
+
+            for (size_t stage = 0; stage < lastStage; ++stage)
+                computeCoefficients(stages[stage], numSamples, [k = stageDamping[stage]](int) { return k; });
+
+            computeCoefficients(stages[lastStage], numSamples, [k = stageDamping[lastStage], resonance](int i)
+            {
+                return k / static_cast<SampleType>(juce::jmax(kMinResonance, resonance[i]));
+            });
+
+            switch (numStages)
+            {
+                case 1:  processLaneGroups<1>(block, numSamples, channelsToProcess); break;
+                case 2:  processLaneGroups<2>(block, numSamples, channelsToProcess); break;
+                case 3:  processLaneGroups<3>(block, numSamples, channelsToProcess); break;
+                default: processLaneGroups<4>(block, numSamples, channelsToProcess); break;
+            }
+        }
+
+    private:
+        static constexpr float kMinCutoff = 10.0f;
+        static constexpr double kMaxCutoffRatio = 0.49;
+        static constexpr float kMinResonance = 0.1f;
+
+        struct LaneState
+        {
+            Register ic1;  // Integrator states, as the trapezoidal rule leaves them
+            Register ic2;
+        };
+
+        // Per-sample coefficients of one stage
+        struct StageCoefficients
+        {
+            std::vector<SampleType> a1;
+            std::vector<SampleType> a2;
+            std::vector<SampleType> a3;
+            std::vector<SampleType> damping;
+        };
+
+        template <typename Damping>
+        void computeCoefficients(StageCoefficients& coefficients, int numSamples, Damping damping) noexcept
+        {
+            const auto* gValues = g.data();
+            auto* a1 = coefficients.a1.data();
+            auto* a2 = coefficients.a2.data();
+            auto* a3 = coefficients.a3.data();
+            auto* k = coefficients.damping.data();
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                k[i] = damping(i);
+                a1[i] = SampleType(1) / (SampleType(1) + gValues[i] * (gValues[i] + k[i]));
+                a2[i] = gValues[i] * a1[i];
+                a3[i] = gValues[i] * a2[i];
+            }
+        }
+
+        template <size_t NumStages>
+        void processLaneGroups(juce::dsp::AudioBlock<SampleType>& block, int numSamples, int channelsToProcess) noexcept
+        {
+            if (type == Type::lowPass)
+                processLaneGroups<NumStages, Type::lowPass>(block, numSamples, channelsToProcess);
+            else
+                processLaneGroups<NumStages, Type::highPass>(block, numSamples, channelsToProcess);
+        }
+
+        template <size_t NumStages, Type FilterType>
+        void processLaneGroups(juce::dsp::AudioBlock<SampleType>& block, int numSamples, int channelsToProcess) noexcept
+        {
+            for (int group = 0; group < numLaneGroups; ++group)
+            {
+                const int firstChannel = group * kNumLanes;
+                const int numLanesUsed = juce::jmin(kNumLanes, channelsToProcess - firstChannel);
+
+                if (numLanesUsed <= 0)
+                    break;
+
+                scratch.interleave(block, firstChannel, numLanesUsed, numSamples);
+
+                auto* groupState = state.data() + group * kMaxStages;
+                std::array<Register, NumStages> ic1;
+                std::array<Register, NumStages> ic2;
+                std::array<const SampleType*, NumStages> a1, a2, a3, damping;
+
+                for (size_t stage = 0; stage < NumStages; ++stage)
+                {
+                    ic1[stage] = groupState[stage].ic1;
+                    ic2[stage] = groupState[stage].ic2;
+                    a1[stage] = stages[stage].a1.data();
+                    a2[stage] = stages[stage].a2.data();
+                    a3[stage] = stages[stage].a3.data();
+                    damping[stage] = stages[stage].damping.data();
+                }
+
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    auto* frame = scratch.getFrame(i);
+                    auto x = Register::fromRawArray(frame);
+
+                    for (size_t stage = 0; stage < NumStages; ++stage)
+                    {
+                        const auto g2 = Register::expand(a2[stage][i]);
+                        const auto v3 = x - ic2[stage];
+                        const auto v1 = Register::expand(a1[stage][i]) * ic1[stage] + g2 * v3;
+                        const auto v2 = ic2[stage] + g2 * ic1[stage] + Register::expand(a3[stage][i]) * v3;
+                        ic1[stage] = v1 + v1 - ic1[stage];
+                        ic2[stage] = v2 + v2 - ic2[stage];
+
+                        if constexpr (FilterType == Type::lowPass)
+                            x = v2;
+                        else
+                            x = x - Register::expand(damping[stage][i]) * v1 - v2;
+                    }
+
+                    x.copyToRawArray(frame);
+                }
+
+                for (size_t stage = 0; stage < NumStages; ++stage)
+                {
+                    groupState[stage].ic1 = Scratch::snapToZero(ic1[stage]);
+                    groupState[stage].ic2 = Scratch::snapToZero(ic2[stage]);
+                }
+
+                scratch.deinterleave(block, firstChannel, numLanesUsed, numSamples);
+            }
+        }
+
+        std::array<StageCoefficients, static_cast<size_t>(kMaxStages)> stages;
+        std::array<SampleType, static_cast<size_t>(kMaxStages)> stageDamping{};
+        std::vector<SampleType> g;
+        std::vector<LaneState> state;
+        Scratch scratch;
+        double sampleRate{44100.0};
+        Type type{Type::lowPass};
+        int maxBlockSize{0};
+        int numChannels{0};
+        int numLaneGroups{0};
+        int numStages{1};
+    };
+}
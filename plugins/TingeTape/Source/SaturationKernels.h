@@ -0,0 +1,101 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <numbers>
+
+// tanh kernels for the Dirt waveshaper, from exact to cheapest. Every kernel is odd,
+// monotonic (up to float rounding where it flattens out), has unit slope at zero and
+// stays within [-1, 1]. Apart from the libm reference they are branch-free (clamps
+// compile to min/max), so a loop over a block vectorises. Errors are the maximum
+// absolute difference from std::tanh over all inputs.
+namespace TylerAudio::TingeTape
+{
+    enum class SaturationKernel
+    {
+        reference,         // std::tanh
+        fastMath,          // juce::dsp::FastMathApproximations::tanh, [7/6] Padé; error < 1e-4
+        pade,              // [5/4] Padé; error < 1.5e-3
+        clampedPolynomial  // 9th order odd polynomial, saturated beyond |x| = 2.5; error < 1.5e-2
+    };
+}
+
+namespace TylerAudio::TingeTape::SaturationKernels
+{
+    template <SaturationKernel Kernel, typename SampleType>
+    [[nodiscard]] SampleType evaluate(SampleType x) noexcept
+    {
+        if constexpr (Kernel == SaturationKernel::reference)
+        {
+            return std::tanh(x);
+        }
+        else if constexpr (Kernel == SaturationKernel::fastMath)
+        {
+            // The approximation is only valid on [-5, 5] and overshoots 1 slightly at the ends
+            const auto clamped = juce::jlimit(SampleType(-5), SampleType(5), x);
+            return juce::jlimit(SampleType(-1), SampleType(1),
+                                juce::dsp::FastMathApproximations::tanh(clamped));
+        }
+        else if constexpr (Kernel == SaturationKernel::pade)
+        {
+            // Rises through 1 near |x| = 3.8; the input clamp only keeps x^4 finite
+            const auto clamped = juce::jlimit(SampleType(-5), SampleType(5), x);
+            const auto x2 = clamped * clamped;
+            const auto numerator = clamped * (SampleType(945) + x2 * (SampleType(105) + x2));
+            const auto denominator = SampleType(945) + x2 * (SampleType(420) + x2 * SampleType(15));
+            return juce::jlimit(SampleType(-1), SampleType(1), numerator / denominator);
+        }
+        else
+        {
+            // Least-squares fit with p'(0) == 1, p(2.5) == 1 and p'(2.5) == 0, so the clamp
+            // joins smoothly
+            const auto clamped = juce::jlimit(SampleType(-2.5), SampleType(2.5), x);
+            const auto x2 = clamped * clamped;
+            return clamped * (SampleType(1) + x2 * (SampleType(-0.2828816097)
+                                            + x2 * (SampleType(0.05983814511)
+                                            + x2 * (SampleType(-0.006434098808)
+                                            + x2 * SampleType(0.000263066368)))));
+        }
+    }
+
+    // Runtime selection, for code outside the per-sample loops
+    template <typename SampleType>
+    [[nodiscard]] SampleType evaluate(SaturationKernel kernel, SampleType x) noexcept
+    {
+        switch (kernel)
+        {
+            case SaturationKernel::reference:         return evaluate<SaturationKernel::reference>(x);
+            case SaturationKernel::fastMath:          return evaluate<SaturationKernel::fastMath>(x);
+            case SaturationKernel::pade:              return evaluate<SaturationKernel::pade>(x);
+            case SaturationKernel::clampedPolynomial: return evaluate<SaturationKernel::clampedPolynomial>(x);
+        }
+
+        return std::tanh(x);
+    }
+
+    // Antiderivatives of tanh for antiderivative anti-aliasing. Both are evaluated in double:
+    // ADAA divides their differences by small input steps, which float can't resolve.
+
+    // log(cosh(x)), written so it neither overflows nor loses precision for large |x|
+    [[nodiscard]] inline double tanhAntiderivative1(double x) noexcept
+    {
+        const double a = std::abs(x);
+        return a + std::log1p(std::exp(-2.0 * a)) - std::numbers::ln2;
+    }
+
+    // Integral of log(cosh(t)) from 0 to x. The dilogarithm in the closed form,
+    // Li2(-w) with w = exp(-2|x|), comes from the Landen identity and the Bernoulli series
+    // in y = log(1 + w) <= log(2), which is accurate to 1e-12 after six terms.
+    [[nodiscard]] inline double tanhAntiderivative2(double x) noexcept
+    {
+        const double a = std::abs(x);
+        const double y = std::log1p(std::exp(-2.0 * a));
+        const double y2 = y * y;
+        const double negativeLi2 = y * (1.0 + y * (0.25 + y * (1.0 / 36.0
+                                       + y2 * (-1.0 / 3600.0 + y2 * (1.0 / 211680.0
+                                       + y2 * (-1.0 / 10886400.0 + y2 * (1.0 / 526901760.0)))))));
+        const double magnitude = 0.5 * a * a - a * std::numbers::ln2 - 0.5 * negativeLi2
+                               + std::numbers::pi * std::numbers::pi / 24.0;
+        return std::copysign(magnitude, x);
+    }
+}
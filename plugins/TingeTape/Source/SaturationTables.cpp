@@ -0,0 +1,99 @@
+#include "SaturationTables.h"
+#include <algorithm>
+
+namespace TylerAudio::TingeTape
+{
+// =============================================================================
+// Saturation Table Implementation
+// =============================================================================
+
+SaturationTable::SaturationTable(int step)
+    : driveStep(juce::jlimit(0, kNumDriveSteps - 1, step))
+{
+    // Built in double with libm tanh: this runs off the audio thread, so exactness is free
+    const double driveGain = 1.0 + 9.0 * driveStep / 100.0;  // Same 1x-10x mapping as TapeSaturation
+    const double normalisation = 1.0 / std::tanh(driveGain);
+
+    for (size_t i = 0; i <= static_cast<size_t>(kNumPoints); ++i)
+    {
+        const double x = static_cast<double>(i) / static_cast<double>(kPointsPerUnit);
+        values[i] = static_cast<float>(std::tanh(x * driveGain) * normalisation);
+    }
+
+    values[static_cast<size_t>(kNumPoints) + 1] = values[static_cast<size_t>(kNumPoints)];
+}
+
+// =============================================================================
+// Saturation Table Cache Implementation
+// =============================================================================
+
+SaturationTableCache::SaturationTableCache()
+    : juce::Thread("TingeTape saturation tables")
+{
+    startThread();
+}
+
+SaturationTableCache::~SaturationTableCache()
+{
+    stopThread(1000);
+}
+
+SaturationTableCache::Client::Client()
+{
+    cache->addClient(*this);
+}
+
+SaturationTableCache::Client::~Client()
+{
+    cache->removeClient(*this);
+}
+
+void SaturationTableCache::addClient(Client& client)
+{
+    const juce::ScopedLock scopedLock(lock);
+    clients.push_back(&client);
+}
+
+void SaturationTableCache::removeClient(Client& client)
+{
+    const juce::ScopedLock scopedLock(lock);
+    clients.erase(std::remove(clients.begin(), clients.end(), &client), clients.end());
+}
+
+const SaturationTable& SaturationTableCache::getTable(int driveStep)
+{
+    const juce::ScopedLock scopedLock(lock);
+    return getOrBuildTable(driveStep);
+}
+
+const SaturationTable& SaturationTableCache::getOrBuildTable(int driveStep)
+{
+    auto& table = tables[static_cast<size_t>(juce::jlimit(0, SaturationTable::kNumDriveSteps - 1, driveStep))];
+
+    if (table == nullptr)
+        table = std::make_unique<const SaturationTable>(driveStep);
+
+    return *table;
+}
+
+void SaturationTableCache::run()
+{
+    while (! threadShouldExit())
+    {
+        {
+            const juce::ScopedLock scopedLock(lock);
+
+            for (auto* client : clients)
+            {
+                const int step = client->requestedStep.load(std::memory_order_relaxed);
+                const auto* current = client->published.load(std::memory_order_relaxed);
+
+                if (step >= 0 && (current == nullptr || current->getDriveStep() != step))
+                    client->published.store(&getOrBuildTable(step), std::memory_order_release);
+            }
+        }
+
+        wait(kPollIntervalMs);
+    }
+}
+}
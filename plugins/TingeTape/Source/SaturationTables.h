@@ -0,0 +1,98 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace TylerAudio::TingeTape
+{
+    // The normalised Dirt transfer curve tanh(x * driveGain) / tanh(driveGain) for one
+    // whole-percent drive setting, sampled densely and read back with linear interpolation.
+    // The curve is odd, so only x >= 0 is stored; beyond kInputRange it is flat to within
+    // float precision. Interpolation error peaks at about 4e-5, at full drive.
+    class SaturationTable
+    {
+    public:
+        static constexpr int kNumDriveSteps = 101;  // 0-100% drive in 1% steps
+        static constexpr int kNumPoints = 4096;
+        static constexpr float kInputRange = 8.0f;
+
+        explicit SaturationTable(int driveStep);
+
+        [[nodiscard]] int getDriveStep() const noexcept { return driveStep; }
+
+        // Nearest table for a 0-100 drive value
+        [[nodiscard]] static int toDriveStep(float drive) noexcept { return juce::roundToInt(juce::jlimit(0.0f, 100.0f, drive)); }
+
+        template <typename SampleType>
+        [[nodiscard]] SampleType lookup(SampleType x) const noexcept
+        {
+            // Written so a NaN input lands on the last point instead of indexing out of range
+            const auto scaled = std::abs(x) * static_cast<SampleType>(kPointsPerUnit);
+            const auto position = scaled < static_cast<SampleType>(kNumPoints) ? scaled : static_cast<SampleType>(kNumPoints);
+            const auto index = static_cast<size_t>(position);
+            const auto fraction = position - static_cast<SampleType>(index);
+            const auto a = static_cast<SampleType>(values[index]);
+            const auto b = static_cast<SampleType>(values[index + 1]);
+            return std::copysign(a + fraction * (b - a), x);
+        }
+
+    private:
+        static constexpr float kPointsPerUnit = static_cast<float>(kNumPoints) / kInputRange;
+
+        std::array<float, kNumPoints + 2> values{};  // One guard point past the end of the range
+        int driveStep;
+    };
+
+    // Process-wide store of SaturationTables shared by every TingeTape instance. Tables are
+    // built on demand by a background thread and kept until the last instance using them
+    // goes away, so the audio thread can hold plain pointers to them. Obtain it through a
+    // juce::SharedResourcePointer.
+    class SaturationTableCache : private juce::Thread
+    {
+    public:
+        SaturationTableCache();
+        ~SaturationTableCache() override;
+
+        // One audio-thread consumer. request() and getLatest() are lock free; the
+        // background thread answers a request within kPollIntervalMs plus one table build.
+        class Client
+        {
+        public:
+            Client();
+            ~Client();
+
+            void request(int driveStep) noexcept { requestedStep.store(driveStep, std::memory_order_relaxed); }
+            [[nodiscard]] const SaturationTable* getLatest() const noexcept { return published.load(std::memory_order_acquire); }
+
+        private:
+            friend class SaturationTableCache;
+
+            juce::SharedResourcePointer<SaturationTableCache> cache;
+            std::atomic<int> requestedStep{-1};
+            std::atomic<const SaturationTable*> published{nullptr};
+
+            JUCE_DECLARE_NON_COPYABLE(Client)
+        };
+
+        // Blocking access for non-realtime code; builds the table if it doesn't exist yet
+        const SaturationTable& getTable(int driveStep);
+
+        static constexpr int kPollIntervalMs = 5;
+
+    private:
+        void run() override;
+        void addClient(Client& client);
+        void removeClient(Client& client);
+        const SaturationTable& getOrBuildTable(int driveStep);
+
+        juce::CriticalSection lock;  // Guards clients and tables; never taken on the audio thread
+        std::vector<Client*> clients;
+        std::array<std::unique_ptr<const SaturationTable>, SaturationTable::kNumDriveSteps> tables;
+
+        JUCE_DECLARE_NON_COPYABLE(SaturationTableCache)
+    };
+}
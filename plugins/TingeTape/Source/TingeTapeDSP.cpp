@@ -0,0 +1,1199 @@
+#include "TingeTapeDSP.h"
+
+namespace TylerAudio::TingeTape
+{
+// =============================================================================
+// Control Ramp Implementation
+// =============================================================================
+
+void ControlRamp::reset(float value) noexcept
+{
+    currentValue = value;
+    targetValue = value;
+    increment = 0.0f;
+    samplesRemaining = 0;
+}
+
+void ControlRamp::render(Utils::SmoothingFilter& smoother, float* destination,
+                         int numSamples, int controlInterval) noexcept
+{
+    if (controlInterval == 1)
+    {
+        // Every sample is a control point, so the smoother's own block render is the ramp
+        smoother.fillBlock(destination, numSamples);
+        reset(smoother.getCurrentValue());
+        return;
+    }
+
+    int i = 0;
+
+    while (i < numSamples)
+    {
+        if (samplesRemaining == 0)
+        {
+            const float smootherTarget = smoother.getTargetValue();
+
+            if (currentValue == smootherTarget && smoother.getCurrentValue() == smootherTarget)
+            {
+                // Settled: the rest of the block holds the value. The skipped control points
+                // stay on the same grid for when the target moves again.
+                std::fill(destination + i, destination + numSamples, currentValue);
+                targetValue = currentValue;
+                increment = 0.0f;
+                samplesRemaining = (controlInterval - (numSamples - i) % controlInterval) % controlInterval;
+                return;
+            }
+
+            // Next control point: step the smoother a whole interval and ramp towards it
+            targetValue = smoother.getNextControlValue();
+            increment = (targetValue - currentValue) / static_cast<float>(controlInterval);
+            samplesRemaining = controlInterval;
+        }
+
+        const int runLength = juce::jmin(samplesRemaining, numSamples - i);
+
+        for (const int end = i + runLength; i < end; ++i)
+        {
+            currentValue += increment;
+            destination[i] = currentValue;
+        }
+
+        samplesRemaining -= runLength;
+
+        if (samplesRemaining == 0)
+        {
+            // Land exactly on the control point so rounding never accumulates
+            currentValue = targetValue;
+            destination[i - 1] = targetValue;
+        }
+    }
+}
+
+// =============================================================================
+// Stage Switch Implementation
+// =============================================================================
+
+template <typename SampleType>
+void StageSwitch<SampleType>::prepare(double sampleRate, int maxBlockSize, int numChannels)
+{
+    dryBuffer.setSize(numChannels, maxBlockSize);
+    fadeLength = juce::jmax(1, juce::roundToInt(sampleRate * kCrossfadeSeconds));
+    reset(false);
+}
+
+template <typename SampleType>
+void StageSwitch<SampleType>::reset(bool shouldBeActive) noexcept
+{
+    isActive = shouldBeActive;
+    wetGain = shouldBeActive ? 1.0f : 0.0f;
+    fadeSamplesRemaining = 0;
+}
+
+template <typename SampleType>
+typename StageSwitch<SampleType>::State StageSwitch<SampleType>::beginBlock(const juce::dsp::AudioBlock<SampleType>& block,
+                                                                            bool shouldBeActive) noexcept
+{
+    auto state = State::running;
+
+    if (shouldBeActive != isActive)
+    {
+        if (shouldBeActive && fadeSamplesRemaining == 0)
+            state = State::started;  // Was fully off, so the stage's state is stale
+
+        // Fade from wherever the gain is now; a reversed fade finishes sooner
+        isActive = shouldBeActive;
+        const float distance = isActive ? 1.0f - wetGain : wetGain;
+        fadeSamplesRemaining = juce::jmax(1, juce::roundToInt(distance * static_cast<float>(fadeLength)));
+    }
+
+    if (! isActive && fadeSamplesRemaining == 0)
+        return State::skipped;
+
+    if (fadeSamplesRemaining > 0)
+    {
+        const auto numChannels = juce::jmin(block.getNumChannels(), static_cast<size_t>(dryBuffer.getNumChannels()));
+        const auto numSamples = static_cast<int>(block.getNumSamples());
+        jassert(numSamples <= dryBuffer.getNumSamples());
+
+        for (size_t channel = 0; channel < numChannels; ++channel)
+            juce::FloatVectorOperations::copy(dryBuffer.getWritePointer(static_cast<int>(channel)),
+                                              block.getChannelPointer(channel), numSamples);
+    }
+
+    return state;
+}
+
+template <typename SampleType>
+void StageSwitch<SampleType>::endBlock(juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    if (fadeSamplesRemaining == 0)
+        return;
+
+    const auto numChannels = juce::jmin(block.getNumChannels(), static_cast<size_t>(dryBuffer.getNumChannels()));
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const int numFadeSamples = juce::jmin(fadeSamplesRemaining, numSamples);
+    const float step = (isActive ? 1.0f : -1.0f) / static_cast<float>(fadeLength);
+
+    for (size_t channel = 0; channel < numChannels; ++channel)
+    {
+        const auto* dry = dryBuffer.getReadPointer(static_cast<int>(channel));
+        auto* data = block.getChannelPointer(channel);
+        float gain = wetGain;
+
+        for (int i = 0; i < numFadeSamples; ++i)
+        {
+            gain = juce::jlimit(0.0f, 1.0f, gain + step);
+            data[i] = dry[i] + (data[i] - dry[i]) * static_cast<SampleType>(gain);
+        }
+
+        // A finished fade-out leaves only the input for the rest of the block
+        if (! isActive && numFadeSamples == fadeSamplesRemaining)
+            juce::FloatVectorOperations::copy(data + numFadeSamples, dry + numFadeSamples, numSamples - numFadeSamples);
+    }
+
+    fadeSamplesRemaining -= numFadeSamples;
+    wetGain = fadeSamplesRemaining == 0 ? (isActive ? 1.0f : 0.0f)
+                                        : juce::jlimit(0.0f, 1.0f, wetGain + step * static_cast<float>(numFadeSamples));
+}
+
+// =============================================================================
+// Transport Modulation Implementation
+// =============================================================================
+
+namespace
+{
+    constexpr int kSineTableSize = 1024;
+
+    // One cycle of sin(2 pi * phase) plus a guard point for interpolation. Built on first
+    // use, which prepare() makes sure happens off the audio thread; read only afterwards.
+    const float* getSineTable()
+    {
+        static const auto table = []
+        {
+            std::array<float, kSineTableSize + 1> values{};
+
+            for (size_t i = 0; i < values.size(); ++i)
+                values[i] = static_cast<float>(std::sin(juce::MathConstants<double>::twoPi
+                                                        * static_cast<double>(i) / kSineTableSize));
+
+            return values;
+        }();
+
+        return table.data();
+    }
+}
+
+void TransportModulation::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+    sineTable = getSineTable();
+    setControlInterval(controlInterval);
+    reset();
+}
+
+void TransportModulation::reset() noexcept
+{
+    wowPhase = 0.5;  // Start at the falling zero crossing, like juce::dsp::Oscillator did
+    flutterPhases.fill(0.0);
+    driftPhase = 0.0;
+
+    // Fixed seed, so renders are repeatable and both precisions wander alike
+    random.setSeed(0x7a9e);
+    driftFrom = 0.0f;
+    driftTo = random.nextFloat() * 2.0f - 1.0f;
+
+    currentValue = 0.0f;
+    targetValue = 0.0f;
+    increment = 0.0f;
+    samplesRemaining = 0;
+}
+
+void TransportModulation::setControlInterval(int numSamples) noexcept
+{
+    controlInterval = juce::jmax(1, numSamples);
+
+    const auto interval = static_cast<double>(controlInterval);
+    wowIncrement = kWowFrequency * interval / sampleRate;
+    driftIncrement = kDriftRate * interval / sampleRate;
+
+    for (size_t partial = 0; partial < kFlutterPartials.size(); ++partial)
+        flutterIncrements[partial] = kFlutterPartials[partial].frequency * interval / sampleRate;
+}
+
+void TransportModulation::render(float* destination, const float* wowDepth, const float* flutterDepth,
+                                 const float* driftDepth, int numSamples) noexcept
+{
+    int i = 0;
+
+    while (i < numSamples)
+    {
+        if (samplesRemaining == 0)
+        {
+            // Next control point: advance every component a whole interval and ramp towards it
+            advance();
+            targetValue = evaluate(wowDepth[i], flutterDepth[i], driftDepth[i]);
+            increment = (targetValue - currentValue) / static_cast<float>(controlInterval);
+            samplesRemaining = controlInterval;
+        }
+
+        // Each sample is offset from the run's start, so the ramp has no serial dependency
+        const int runLength = juce::jmin(samplesRemaining, numSamples - i);
+        const float start = currentValue;
+
+        for (int j = 0; j < runLength; ++j)
+            destination[i + j] = start + increment * static_cast<float>(j + 1);
+
+        i += runLength;
+        samplesRemaining -= runLength;
+        currentValue = start + increment * static_cast<float>(runLength);
+
+        if (samplesRemaining == 0)
+        {
+            // Land exactly on the control point so rounding never accumulates
+            currentValue = targetValue;
+            destination[i - 1] = targetValue;
+        }
+    }
+}
+
+void TransportModulation::advance() noexcept
+{
+    const auto wrap = [](double& phase, double phaseIncrement)
+    {
+        phase += phaseIncrement;
+        phase -= std::floor(phase);
+    };
+
+    wrap(wowPhase, wowIncrement);
+
+    for (size_t partial = 0; partial < kFlutterPartials.size(); ++partial)
+        wrap(flutterPhases[partial], flutterIncrements[partial]);
+
+    driftPhase += driftIncrement;
+
+    if (driftPhase >= 1.0)
+    {
+        // Next random target; the control rate is far above kDriftRate, so at most one per step
+        driftPhase -= std::floor(driftPhase);
+        driftFrom = driftTo;
+        driftTo = random.nextFloat() * 2.0f - 1.0f;
+    }
+}
+
+float TransportModulation::evaluate(float wowDepth, float flutterDepth, float driftDepth) const noexcept
+{
+    float offsetMs = 0.0f;
+
+    if (wowDepth > 0.0f)
+        offsetMs += lookupSine(wowPhase) * juce::jmin(wowDepth, 100.0f) * (kWowRangeMs / 100.0f);
+
+    if (flutterDepth > 0.0f)
+    {
+        float flutter = 0.0f;
+
+        for (size_t partial = 0; partial < kFlutterPartials.size(); ++partial)
+            flutter += lookupSine(flutterPhases[partial]) * kFlutterPartials[partial].weight;
+
+        offsetMs += flutter * juce::jmin(flutterDepth, 100.0f) * (kFlutterRangeMs / 100.0f);
+    }
+
+    if (driftDepth > 0.0f)
+    {
+        // Raised-cosine interpolation between random targets keeps the wander band-limited;
+        // cos(pi * x) is read from the sine table a quarter cycle on
+        const float blend = 0.5f - 0.5f * lookupSine(0.25 + driftPhase * 0.5);
+        const float drift = driftFrom + (driftTo - driftFrom) * blend;
+        offsetMs += drift * juce::jmin(driftDepth, 100.0f) * (kDriftRangeMs / 100.0f);
+    }
+
+    return offsetMs;
+}
+
+float TransportModulation::lookupSine(double phase) const noexcept
+{
+    const auto position = phase * kSineTableSize;
+    const auto index = juce::jlimit(0, kSineTableSize - 1, static_cast<int>(position));
+    const auto fraction = static_cast<float>(position - index);
+    return sineTable[index] + fraction * (sineTable[index + 1] - sineTable[index]);
+}
+
+// =============================================================================
+// Wow Engine Implementation
+// =============================================================================
+
+template <typename SampleType>
+void WowEngine<SampleType>::prepare(double sampleRate, int maxBlockSize, int numChannels)
+{
+    this->sampleRate = static_cast<float>(sampleRate);
+    this->numChannels = numChannels;
+
+    // One interleaved delay line for all channels, which read it with the same modulated
+    // delay. It only needs to reach the longest delay the modulation can produce.
+    const auto maxDelay = static_cast<int>(std::ceil(sampleRate * static_cast<double>(kMaxDelayMs) / 1000.0));
+    delayLine.prepare(maxDelay, maxBlockSize, numChannels);
+    maxDelaySamples = static_cast<float>(maxDelay);
+
+    delayControl.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+    modulation.prepare(sampleRate);
+
+    reset();
+}
+
+template <typename SampleType>
+void WowEngine<SampleType>::process(juce::dsp::AudioBlock<SampleType>& block, const float* wowControl,
+                                    const float* flutterControl, const float* driftControl) noexcept
+{
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const auto channelsToProcess = juce::jmin(numChannels, static_cast<int>(block.getNumChannels()));
+    jassert(numSamples <= static_cast<int>(delayControl.size()));
+
+    // Research-compliant delay calculation:
+    // modulatedDelayMs = baseDelayMs + (lfoOutput * depthParam * maxModulationMs) + flutter + drift
+    const float samplesPerMs = sampleRate / 1000.0f;
+
+    // Render the modulation once per block into a delay curve shared by every channel, so
+    // it advances once per sample frame whatever the channel count and all channels of a
+    // bus see the same (correlated) wow. Neutral depths are handled by the processor
+    // skipping the whole stage.
+    auto* delay = delayControl.data();
+    modulation.render(delay, wowControl, flutterControl, driftControl, numSamples);
+
+    for (int i = 0; i < numSamples; ++i)
+        delay[i] = juce::jlimit(1.0f, maxDelaySamples, (kBaseDelayMs + delay[i]) * samplesPerMs);
+
+    auto channelBlock = block.getSubsetChannelBlock(0, static_cast<size_t>(channelsToProcess));
+    delayLine.process(channelBlock, delay);
+}
+
+template <typename SampleType>
+size_t WowEngine<SampleType>::getMemoryUsageBytes() const noexcept
+{
+    return delayLine.getMemoryUsageBytes() + delayControl.capacity() * sizeof(float);
+}
+
+template <typename SampleType>
+void WowEngine<SampleType>::processBypassed(const juce::dsp::AudioBlock<SampleType>& block) noexcept
+{
+    delayLine.push(block);
+}
+
+template <typename SampleType>
+void WowEngine<SampleType>::reset() noexcept
+{
+    delayLine.reset();
+    modulation.reset();
+}
+
+// =============================================================================
+// Tape Saturation Implementation
+// =============================================================================
+
+template <typename SampleType>
+void TapeSaturation<SampleType>::prepare(double sampleRate, int maxBlockSize, int numChannels)
+{
+    this->sampleRate = sampleRate;
+    this->numChannels = numChannels;
+    const auto numLaneGroups = static_cast<size_t>(LaneScratch::getNumLaneGroups(numChannels));
+    rolloffStates.assign(numLaneGroups, Register::expand(SampleType(0)));
+    rolloffCoefficients.assign(static_cast<size_t>(maxBlockSize), SampleType(0));
+    levelCompensation.assign(static_cast<size_t>(maxBlockSize), SampleType(1));
+    laneScratch.prepare(maxBlockSize);
+    hysteresisStates.assign(numLaneGroups, {});
+    hysteresisScratch.prepare(maxBlockSize << (kNumOversamplingFactors - 1));
+    antiderivativeStates.assign(static_cast<size_t>(numChannels), {});
+    driveGains.assign(static_cast<size_t>(maxBlockSize), SampleType(1));
+    normalisation.assign(static_cast<size_t>(maxBlockSize), SampleType(1));
+
+    constexpr std::array<typename Oversampler::FilterType, kNumOversamplingFilters> filterTypes{
+        Oversampler::filterHalfBandPolyphaseIIR,  // OversamplingFilter::polyphaseIIR
+        Oversampler::filterHalfBandFIREquiripple  // OversamplingFilter::linearPhaseFIR
+    };
+
+    for (size_t filter = 0; filter < oversamplers.size(); ++filter)
+    {
+        for (size_t factorLog2 = 1; factorLog2 < oversamplers[filter].size(); ++factorLog2)
+        {
+            // Integer latency so it can be reported to the host exactly
+            auto& oversampler = oversamplers[filter][factorLog2];
+            oversampler = std::make_unique<Oversampler>(static_cast<size_t>(numChannels), factorLog2,
+                                                        filterTypes[filter], true, true);
+            oversampler->initProcessing(static_cast<size_t>(maxBlockSize));
+        }
+    }
+
+    activeOversampler = nullptr;
+    setOversampling(oversamplingFactor, oversamplingFilter);
+
+    // The shared cache and its worker thread only exist while some instance uses tables
+    if (! useTransferTables)
+        tableClient.reset();
+    else if (tableClient == nullptr)
+        tableClient = std::make_unique<SaturationTableCache::Client>();
+
+    activeTable = nullptr;
+    fadingTable = nullptr;
+    tableFadePosition = kTableCrossfadeSamples;
+
+    reset();
+}
+
+template <typename SampleType>
+void TapeSaturation<SampleType>::setOversampling(OversamplingFactor factor, OversamplingFilter filter) noexcept
+{
+    auto* selected = oversamplers[static_cast<size_t>(filter)][static_cast<size_t>(factor)].get();
+
+    if (selected != activeOversampler && selected != nullptr)
+        selected->reset();
+
+    activeOversampler = selected;
+    oversamplingFactor = factor;
+    oversamplingFilter = filter;
+}
+
+template <typename SampleType>
+void TapeSaturation<SampleType>::setAntialiasing(SaturationAntialiasing mode) noexcept
+{
+    // The two orders keep different state, so start either from silence
+    if (mode != antialiasing)
+        std::fill(antiderivativeStates.begin(), antiderivativeStates.end(), AntiderivativeState{});
+
+    antialiasing = mode;
+}
+
+template <typename SampleType>
+void TapeSaturation<SampleType>::setModel(SaturationModel newModel) noexcept
+{
+    if (newModel != model)
+        std::fill(hysteresisStates.begin(), hysteresisStates.end(), HysteresisState{});
+
+    model = newModel;
+}
+
+template <typename SampleType>
+int TapeSaturation<SampleType>::getLatencySamples() const noexcept
+{
+    return activeOversampler != nullptr ? static_cast<int>(std::lround(activeOversampler->getLatencyInSamples()))
+                                        : 0;
+}
+
+template <typename SampleType>
+void TapeSaturation<SampleType>::process(juce::dsp::AudioBlock<SampleType>& block, const float* driveControl) noexcept
+{
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const auto channelsToProcess = juce::jmin(static_cast<size_t>(numChannels), block.getNumChannels());
+    jassert(numSamples <= static_cast<int>(normalisation.size()));
+
+    if (numSamples == 0)
+        return;
+
+    const auto toDrive = [](float control)
+    {
+        return static_cast<SampleType>(juce::jlimit(0.0f, 100.0f, control) / 100.0f);
+    };
+
+    // Research-compliant drive scaling: 1x to 10x gain (not 1x to 5x)
+    const auto driveToGain = [](SampleType drive) { return SampleType(1) + drive * SampleType(9); };
+
+    if (tableClient != nullptr)
+    {
+        // Ask for the table at the block's final drive, and take up whatever has been
+        // published once any crossfade in progress has finished
+        tableClient->request(SaturationTable::toDriveStep(driveControl[numSamples - 1]));
+        const auto* latest = tableClient->getLatest();
+
+        if (latest != activeTable && tableFadePosition == kTableCrossfadeSamples)
+        {
+            fadingTable = activeTable;
+            activeTable = latest;
+            tableFadePosition = 0;
+        }
+    }
+
+    const bool needsKernel = model == SaturationModel::hysteresis || antialiasing != SaturationAntialiasing::none || activeTable == nullptr
+                             || (fadingTable == nullptr && tableFadePosition < kTableCrossfadeSamples);
+
+    if (needsKernel)
+    {
+        auto* gains = driveGains.data();
+
+        for (int i = 0; i < numSamples; ++i)
+            gains[i] = driveToGain(toDrive(driveControl[i]));
+
+        // The tanh(driveGain) normalisation is evaluated once per control interval for all
+        // channels and linearly interpolated in between. It uses the same kernel as the
+        // waveshaper, so a full-scale input still peaks at exactly 1. The hysteresis model
+        // is normalised by its anhysteretic curve, which bounds the magnetisation instead.
+        const auto normalise = [this](SampleType gain)
+        {
+            return model == SaturationModel::hysteresis
+                       ? static_cast<SampleType>(1.0 / JilesAtherton::anhysteretic(static_cast<double>(gain)))
+                       : SampleType(1) / SaturationKernels::evaluate(kernel, gain);
+        };
+        auto* norm = normalisation.data();
+        SampleType pointValue = normalise(gains[0]);
+
+        for (int start = 0; start < numSamples; start += controlInterval)
+        {
+            const int end = juce::jmin(start + controlInterval, numSamples);
+            const int nextPoint = juce::jmin(end, numSamples - 1);
+            const SampleType nextValue = normalise(gains[nextPoint]);
+            const SampleType step = nextPoint > start ? (nextValue - pointValue) / static_cast<SampleType>(nextPoint - start)
+                                                      : SampleType(0);
+
+            for (int i = start; i < end; ++i)
+                norm[i] = pointValue + step * static_cast<SampleType>(i - start);
+
+            pointValue = nextValue;
+        }
+    }
+
+    auto channelBlock = block.getSubsetChannelBlock(0, channelsToProcess);
+
+    if (activeOversampler != nullptr)
+    {
+        auto oversampledBlock = activeOversampler->processSamplesUp(channelBlock);
+        applyWaveshaper(oversampledBlock, static_cast<int>(oversamplingFactor));
+        activeOversampler->processSamplesDown(channelBlock);
+    }
+    else
+    {
+        applyWaveshaper(channelBlock, 0);
+    }
+
+    applyRolloff(channelBlock, driveControl);
+}
+
+// Drive-dependent one-pole HF rolloff (more rolloff with more drive) and level
+// compensation, for every channel at once
+template <typename SampleType>
+void TapeSaturation<SampleType>::applyRolloff(juce::dsp::AudioBlock<SampleType>& block, const float* driveControl) noexcept
+{
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const auto channelsToProcess = static_cast<int>(block.getNumChannels());
+    auto* coefficients = rolloffCoefficients.data();
+    auto* compensation = levelCompensation.data();
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto drive = static_cast<SampleType>(juce::jlimit(0.0f, 100.0f, driveControl[i]) / 100.0f);
+        const SampleType rolloffAmount = kHighFreqRolloff + (drive * SampleType(0.08));
+        coefficients[i] = juce::jlimit(SampleType(0.1), SampleType(0.98), rolloffAmount);
+
+        // Improved level compensation to maintain consistent output levels
+        compensation[i] = SampleType(1) / (SampleType(1) + drive * SampleType(0.5));  // Gentle compensation
+    }
+
+    for (size_t group = 0; group < rolloffStates.size(); ++group)
+    {
+        const int firstChannel = static_cast<int>(group) * LaneScratch::kNumLanes;
+        const int numLanesUsed = juce::jmin(LaneScratch::kNumLanes, channelsToProcess - firstChannel);
+
+        if (numLanesUsed <= 0)
+            break;
+
+        laneScratch.interleave(block, firstChannel, numLanesUsed, numSamples);
+        auto state = rolloffStates[group];
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto* frame = laneScratch.getFrame(i);
+            const auto alpha = coefficients[i];
+            state = state * alpha + Register::fromRawArray(frame) * (SampleType(1) - alpha);
+            (state * compensation[i]).copyToRawArray(frame);
+        }
+
+        // Denormal protection once per block: only the filter state carries over, and the
+        // processor sanitises the output
+        rolloffStates[group] = LaneScratch::snapToZero(state);
+        laneScratch.deinterleave(block, firstChannel, numLanesUsed, numSamples);
+    }
+}
+
+template <typename SampleType>
+void TapeSaturation<SampleType>::applyWaveshaper(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept
+{
+    hysteresisSolverSteps = 0;
+
+    if (model == SaturationModel::hysteresis)
+    {
+        switch (hysteresisSolver)
+        {
+            case HysteresisSolver::rk2:           applyHysteresis<HysteresisSolver::rk2>(block, factorLog2); break;
+            case HysteresisSolver::rk4:           applyHysteresis<HysteresisSolver::rk4>(block, factorLog2); break;
+            case HysteresisSolver::newtonRaphson: applyHysteresis<HysteresisSolver::newtonRaphson>(block, factorLog2); break;
+        }
+
+        return;
+    }
+
+    if (antialiasing == SaturationAntialiasing::firstOrder)
+    {
+        applyAntiderivativeWaveshaper<1>(block, factorLog2);
+        return;
+    }
+
+    if (antialiasing == SaturationAntialiasing::secondOrder)
+    {
+        applyAntiderivativeWaveshaper<2>(block, factorLog2);
+        return;
+    }
+
+    if (activeTable != nullptr)
+    {
+        applyTransferTable(block, factorLog2);
+        return;
+    }
+
+    switch (kernel)
+    {
+        case SaturationKernel::reference:         applyWaveshaper<SaturationKernel::reference>(block, factorLog2); break;
+        case SaturationKernel::fastMath:          applyWaveshaper<SaturationKernel::fastMath>(block, factorLog2); break;
+        case SaturationKernel::pade:              applyWaveshaper<SaturationKernel::pade>(block, factorLog2); break;
+        case SaturationKernel::clampedPolynomial: applyWaveshaper<SaturationKernel::clampedPolynomial>(block, factorLog2); break;
+    }
+}
+
+// Research-compliant tanh saturation with proper normalization:
+// output = tanh(input * driveGain) / tanh(driveGain)
+// The block may run at 2^factorLog2 times the base rate; each base-rate gain and
+// normalisation then covers that many consecutive samples.
+template <typename SampleType>
+template <SaturationKernel Kernel>
+void TapeSaturation<SampleType>::applyWaveshaper(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept
+{
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const auto* gains = driveGains.data();
+    const auto* norm = normalisation.data();
+
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        auto* data = block.getChannelPointer(channel);
+
+        if (factorLog2 == 0)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                data[i] = SaturationKernels::evaluate<Kernel>(data[i] * gains[i]) * norm[i];
+        }
+        else
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const int controlIndex = i >> factorLog2;
+                data[i] = SaturationKernels::evaluate<Kernel>(data[i] * gains[controlIndex]) * norm[controlIndex];
+            }
+        }
+    }
+}
+
+// The table holds the normalised curve for the drive it was built for, so it replaces
+// both the kernel and the normalisation. A newly taken up table fades in from the previous
+// one, or from the kernel if it is the first.
+template <typename SampleType>
+void TapeSaturation<SampleType>::applyTransferTable(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept
+{
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const int fadeLength = juce::jmin(numSamples, kTableCrossfadeSamples - tableFadePosition);
+    const auto* gains = driveGains.data();
+    const auto* norm = normalisation.data();
+
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        auto* data = block.getChannelPointer(channel);
+
+        for (int i = 0; i < fadeLength; ++i)
+        {
+            const int controlIndex = i >> factorLog2;
+            const SampleType target = activeTable->lookup(data[i]);
+            const SampleType source = fadingTable != nullptr
+                                          ? fadingTable->lookup(data[i])
+                                          : SaturationKernels::evaluate(kernel, data[i] * gains[controlIndex]) * norm[controlIndex];
+            const SampleType fade = static_cast<SampleType>(tableFadePosition + i + 1) / static_cast<SampleType>(kTableCrossfadeSamples);
+            data[i] = source + fade * (target - source);
+        }
+
+        for (int i = fadeLength; i < numSamples; ++i)
+            data[i] = activeTable->lookup(data[i]);
+    }
+
+    tableFadePosition += fadeLength;
+
+    if (tableFadePosition == kTableCrossfadeSamples)
+        fadingTable = nullptr;
+}
+
+// Antiderivative anti-aliasing: instead of sampling tanh at each input, average it over
+// the straight line (first order) or triangle (second order) joining the last inputs,
+// using divided differences of its antiderivatives. The averaging suppresses the
+// harmonics that would alias, and stays exact for DC so the normalisation still holds.
+template <typename SampleType>
+template <int Order>
+void TapeSaturation<SampleType>::applyAntiderivativeWaveshaper(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept
+{
+    static_assert(Order == 1 || Order == 2);
+
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const auto* gains = driveGains.data();
+    const auto* norm = normalisation.data();
+
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        auto* data = block.getChannelPointer(channel);
+        auto state = antiderivativeStates[channel];
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const int controlIndex = i >> factorLog2;
+            const double input = static_cast<double>(data[i] * gains[controlIndex]);
+            const double delta = input - state.previousInput;
+            double shaped;
+
+            if constexpr (Order == 1)
+            {
+                const double antiderivative = SaturationKernels::tanhAntiderivative1(input);
+                shaped = std::abs(delta) > kAntiderivativeTolerance ? (antiderivative - state.previousAntiderivative) / delta
+                                                                    : std::tanh(0.5 * (input + state.previousInput));
+                state.previousAntiderivative = antiderivative;
+            }
+            else
+            {
+                const double antiderivative = SaturationKernels::tanhAntiderivative2(input);
+                const double difference = std::abs(delta) > kAntiderivativeTolerance
+                                              ? (antiderivative - state.previousAntiderivative) / delta
+                                              : SaturationKernels::tanhAntiderivative1(0.5 * (input + state.previousInput));
+                const double outerDelta = input - state.olderInput;
+
+                if (std::abs(outerDelta) > kAntiderivativeTolerance)
+                {
+                    shaped = 2.0 * (difference - state.previousDifference) / outerDelta;
+                }
+                else
+                {
+                    // The input came back to where it was two samples ago: average over the
+                    // triangle's two halves, which now coincide
+                    const double midpoint = 0.5 * (input + state.olderInput);
+                    const double halfDelta = midpoint - state.previousInput;
+
+                    shaped = std::abs(halfDelta) > kAntiderivativeTolerance
+                                 ? 2.0 / halfDelta * (SaturationKernels::tanhAntiderivative1(midpoint)
+                                                      + (state.previousAntiderivative - SaturationKernels::tanhAntiderivative2(midpoint)) / halfDelta)
+                                 : std::tanh(0.5 * (midpoint + state.previousInput));
+                }
+
+                state.olderInput = state.previousInput;
+                state.previousAntiderivative = antiderivative;
+                state.previousDifference = difference;
+            }
+
+            state.previousInput = input;
+            data[i] = static_cast<SampleType>(shaped) * norm[controlIndex];
+        }
+
+        antiderivativeStates[channel] = state;
+    }
+}
+
+// Jiles-Atherton hysteresis: the driven input is the field H and the tape's magnetisation
+// M is integrated from dM/dt = dM/dH * dH/dt, one lane group at a time. Between samples H
+// is taken to move in a straight line, so dH/dt is constant over each step. The Runge-Kutta
+// solvers split steep edges into substeps; Newton-Raphson solves the trapezoidal rule.
+// Either way the steps per sample and per block are capped, so the worst case cost is
+// bounded; the samples are oversampled ones, so the bound per host sample scales with
+// the factor. M is kept within saturation, which a capped explicit step can still overshoot,
+// and a one-pole DC blocker then removes the remanence.
+template <typename SampleType>
+template <HysteresisSolver Solver>
+void TapeSaturation<SampleType>::applyHysteresis(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept
+{
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const auto channelsToProcess = static_cast<int>(block.getNumChannels());
+    const auto* gains = driveGains.data();
+    const auto* norm = normalisation.data();
+
+    const double rate = sampleRate * static_cast<double>(1 << factorLog2);
+    const double step = 1.0 / rate;
+    const double halfStep = 0.5 * step;
+    const double dcPole = std::exp(-juce::MathConstants<double>::twoPi * kHysteresisDcCutoffHz / rate);
+
+    const auto evaluate = [](double m, double h, double hRate)
+    {
+        return JilesAtherton::magnetisationRate<false>(m, h, hRate).value;
+    };
+
+    for (size_t group = 0; group < hysteresisStates.size(); ++group)
+    {
+        const int firstChannel = static_cast<int>(group) * LaneScratch::kNumLanes;
+        const int numLanesUsed = juce::jmin(LaneScratch::kNumLanes, channelsToProcess - firstChannel);
+
+        if (numLanesUsed <= 0)
+            break;
+
+        // Lanes past the last channel are left alone: the solver runs lane by lane, so
+        // padding them would cost as much as a real channel
+        const auto lanesUsed = static_cast<size_t>(numLanesUsed);
+        hysteresisScratch.interleave(block, firstChannel, numLanesUsed, numSamples);
+        auto state = hysteresisStates[group];
+        int budget = kSolverStepBudget * numSamples;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto* frame = hysteresisScratch.getFrame(i);
+            const int controlIndex = i >> factorLog2;
+            const auto gain = static_cast<double>(gains[controlIndex]);
+            LaneValues field{};
+            LaneValues fieldRate{};
+
+            // Keep at least one step in hand for every sample still to come
+            const int allowed = juce::jlimit(1, kMaxSolverSteps, budget - (numSamples - i - 1));
+            double largestChange = 0.0;
+
+            for (size_t lane = 0; lane < lanesUsed; ++lane)
+            {
+                field[lane] = static_cast<double>(frame[lane]) * gain;
+                fieldRate[lane] = (field[lane] - state.field[lane]) * rate;
+                largestChange = juce::jmax(largestChange, std::abs(field[lane] - state.field[lane]));
+            }
+
+            if constexpr (Solver == HysteresisSolver::newtonRaphson)
+            {
+                LaneValues target{};
+                LaneValues estimate{};
+
+                for (size_t lane = 0; lane < lanesUsed; ++lane)
+                {
+                    const double startRate = evaluate(state.magnetisation[lane], state.field[lane], fieldRate[lane]);
+                    target[lane] = state.magnetisation[lane] + halfStep * startRate;
+                    estimate[lane] = juce::jlimit(-JilesAtherton::kSaturation, JilesAtherton::kSaturation,
+                                                  state.magnetisation[lane] + step * startRate);
+                }
+
+                // All lanes iterate together until every one of them has converged
+                int iterations = 0;
+                bool converged = false;
+
+                while (! converged && iterations < allowed)
+                {
+                    converged = true;
+                    ++iterations;
+
+                    for (size_t lane = 0; lane < lanesUsed; ++lane)
+                    {
+                        const auto derivative = JilesAtherton::magnetisationRate<true>(estimate[lane], field[lane], fieldRate[lane]);
+                        const double residual = estimate[lane] - halfStep * derivative.value - target[lane];
+                        const double correction = residual / (1.0 - halfStep * derivative.slope);
+                        estimate[lane] -= correction;
+                        converged = converged && std::abs(correction) < kNewtonTolerance;
+                    }
+                }
+
+                budget -= iterations;
+                hysteresisSolverSteps += iterations;
+                state.magnetisation = estimate;
+            }
+            else
+            {
+                const int substeps = juce::jlimit(1, allowed, static_cast<int>(std::ceil(largestChange / kMaxSubstepField)));
+                const double substep = step / static_cast<double>(substeps);
+                LaneValues change;
+
+                for (size_t lane = 0; lane < lanesUsed; ++lane)
+                    change[lane] = (field[lane] - state.field[lane]) / static_cast<double>(substeps);
+
+                for (int n = 0; n < substeps; ++n)
+                {
+                    for (size_t lane = 0; lane < lanesUsed; ++lane)
+                    {
+                        const double m = state.magnetisation[lane];
+                        const double hRate = fieldRate[lane];
+                        const double startField = state.field[lane] + change[lane] * static_cast<double>(n);
+                        const double midField = startField + 0.5 * change[lane];
+                        const double k1 = evaluate(m, startField, hRate);
+                        double next;
+
+                        if constexpr (Solver == HysteresisSolver::rk2)
+                        {
+                            next = m + substep * evaluate(m + 0.5 * substep * k1, midField, hRate);
+                        }
+                        else
+                        {
+                            const double k2 = evaluate(m + 0.5 * substep * k1, midField, hRate);
+                            const double k3 = evaluate(m + 0.5 * substep * k2, midField, hRate);
+                            const double k4 = evaluate(m + substep * k3, startField + change[lane], hRate);
+                            next = m + substep / 6.0 * (k1 + 2.0 * (k2 + k3) + k4);
+                        }
+
+                        state.magnetisation[lane] = juce::jlimit(-JilesAtherton::kSaturation, JilesAtherton::kSaturation, next);
+                    }
+                }
+
+                budget -= substeps;
+                hysteresisSolverSteps += substeps;
+            }
+
+            for (size_t lane = 0; lane < lanesUsed; ++lane)
+            {
+                const double m = juce::jlimit(-JilesAtherton::kSaturation, JilesAtherton::kSaturation, state.magnetisation[lane]);
+                state.magnetisation[lane] = m;
+                state.dcOutput[lane] = m - state.dcInput[lane] + dcPole * state.dcOutput[lane];
+                state.dcInput[lane] = m;
+                frame[lane] = static_cast<SampleType>(state.dcOutput[lane]) * norm[controlIndex];
+            }
+
+            state.field = field;
+        }
+
+        for (auto& value : state.dcOutput)
+            if (std::abs(value) < static_cast<double>(Constants::kDenormalThreshold))
+                value = 0.0;
+
+        hysteresisStates[group] = state;
+        hysteresisScratch.deinterleave(block, firstChannel, numLanesUsed, numSamples);
+    }
+}
+
+template <typename SampleType>
+void TapeSaturation<SampleType>::reset() noexcept
+{
+    std::fill(rolloffStates.begin(), rolloffStates.end(), Register::expand(SampleType(0)));
+    std::fill(antiderivativeStates.begin(), antiderivativeStates.end(), AntiderivativeState{});
+    std::fill(hysteresisStates.begin(), hysteresisStates.end(), HysteresisState{});
+
+    if (activeOversampler != nullptr)
+        activeOversampler->reset();
+}
+
+template <typename SampleType>
+double TapeSaturation<SampleType>::getTailLengthSeconds(double sampleRate, double decayDb, SaturationModel model) noexcept
+{
+    // The one-pole rolloff is slowest at full drive, where alpha reaches its 0.98 ceiling
+    constexpr double maxAlpha = 0.98;
+    const double decayNepers = decayDb / 20.0 * std::log(10.0);
+    const double rolloffSeconds = decayNepers / -std::log(maxAlpha) / sampleRate;
+
+    if (model != SaturationModel::hysteresis)
+        return rolloffSeconds;
+
+    // The DC blocker's time constant doesn't depend on the rate it runs at
+    return rolloffSeconds + decayNepers / (juce::MathConstants<double>::twoPi * kHysteresisDcCutoffHz);
+}
+
+// =============================================================================
+// Tone Control Implementation
+// =============================================================================
+
+template <typename SampleType>
+void ToneControl<SampleType>::prepare(double sampleRate, int maxBlockSize, int numChannels, int numFixedSections)
+{
+    jassert(numFixedSections >= 0 && numFixedSections <= kMaxFixedSections);
+
+    this->sampleRate = sampleRate;
+    this->numFixedSections = juce::jlimit(0, kMaxFixedSections, numFixedSections);
+    cascade.prepare(maxBlockSize, numChannels, this->numFixedSections + static_cast<int>(std::tuple_size_v<ShelfPair>));
+
+    // Every section's coefficients per ramp; ramps are never shorter than kMinRampLength,
+    // bar the first and last
+    const auto maxRamps = static_cast<size_t>(juce::jmax(1, maxBlockSize) / kMinRampLength + 2);
+    rampTargets.resize(maxRamps * static_cast<size_t>(kMaxFixedSections + static_cast<int>(std::tuple_size_v<ShelfPair>)));
+
+    for (size_t point = 0; point < designs.size(); ++point)
+        designs[point] = design(-1.0f + 2.0f * static_cast<float>(point) / static_cast<float>(kNumDesignPoints - 1));
+
+    reset();
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::setControlInterval(int numSamples) noexcept
+{
+    const int interval = juce::jmax(1, numSamples);
+    rampLength = interval * ((kMinRampLength + interval - 1) / interval);
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::process(juce::dsp::AudioBlock<SampleType>& block, const float* toneControl,
+                                      int firstFixedSection) noexcept
+{
+    jassert(firstFixedSection >= 0 && firstFixedSection <= numFixedSections);
+
+    // Normalize to -1.0 to +1.0
+    const auto normalise = [](float tone) { return juce::jlimit(-100.0f, 100.0f, tone) / 100.0f; };
+
+    const auto numSamples = static_cast<int>(block.getNumSamples());
+    const int numSections = cascade.getNumSections() - firstFixedSection;
+
+    if (numSamples == 0)
+        return;
+
+    if (snapToTone)
+    {
+        currentTone = normalise(toneControl[0]);
+        currentDesign = interpolateDesigns(currentTone);
+        setCoefficients(currentDesign);
+        snapToTone = false;
+    }
+
+    // Ramps run back to back across blocks and end on control points, unless the block
+    // ends first. Over each one the shelves move to the design for the tone at its end,
+    // and the fixed sections keep their coefficients.
+    const int firstRampLength = samplesUntilUpdate > 0 ? samplesUntilUpdate : rampLength;
+    auto* targets = rampTargets.data();
+    bool moving = false;
+
+    for (int start = 0, length = firstRampLength; start < numSamples; start += length, length = rampLength)
+    {
+        const int end = juce::jmin(start + length, numSamples);
+        const float targetTone = normalise(toneControl[end - 1]);
+
+        if (targetTone != currentTone)
+        {
+            currentTone = targetTone;
+            currentDesign = interpolateDesigns(targetTone);
+            moving = true;
+        }
+
+        for (int section = firstFixedSection; section < numFixedSections; ++section)
+        {
+            const auto* fixed = cascade.getCoefficients(section);
+            std::copy(fixed, fixed + BiquadDesign::kNumCoefficients, (targets++)->begin());
+        }
+
+        targets = std::copy(currentDesign.begin(), currentDesign.end(), targets);
+        samplesUntilUpdate = start + length - end;
+    }
+
+    // A held tone leaves every target where it started, so filter with fixed coefficients
+    if (moving)
+        cascade.processRamped(block, firstFixedSection, numSections, rampTargets.data(), firstRampLength, rampLength);
+    else
+        cascade.process(block, firstFixedSection, numSections);
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::processFixed(juce::dsp::AudioBlock<SampleType>& block, int firstFixedSection, int count) noexcept
+{
+    jassert(firstFixedSection >= 0 && firstFixedSection + count <= numFixedSections);
+    cascade.process(block, firstFixedSection, count);
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::reset() noexcept
+{
+    cascade.reset();
+    resetShelves();
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::resetShelves() noexcept
+{
+    cascade.reset(numFixedSections, static_cast<int>(std::tuple_size_v<ShelfPair>));
+    samplesUntilUpdate = 0;
+    snapToTone = true;
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::resetFixedSections() noexcept
+{
+    cascade.reset(0, numFixedSections);
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::resetFixedSections(int firstFixedSection, int count) noexcept
+{
+    jassert(firstFixedSection >= 0 && firstFixedSection + count <= numFixedSections);
+    cascade.reset(firstFixedSection, count);
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::setNumFixedSections(int newNumFixedSections) noexcept
+{
+    jassert(newNumFixedSections >= 0 && newNumFixedSections <= kMaxFixedSections);
+    newNumFixedSections = juce::jlimit(0, kMaxFixedSections, newNumFixedSections);
+
+    const int numShelves = static_cast<int>(std::tuple_size_v<ShelfPair>);
+    cascade.moveSections(numFixedSections, newNumFixedSections, numShelves);
+    cascade.setNumSections(newNumFixedSections + numShelves);
+    numFixedSections = newNumFixedSections;
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::moveFixedSections(int firstFixedSection, int destination, int count) noexcept
+{
+    jassert(firstFixedSection >= 0 && firstFixedSection + count <= numFixedSections);
+    jassert(destination >= 0 && destination + count <= numFixedSections);
+    cascade.moveSections(firstFixedSection, destination, count);
+}
+
+template <typename SampleType>
+SampleType* ToneControl<SampleType>::getFixedCoefficients(int section) noexcept
+{
+    jassert(juce::isPositiveAndBelow(section, numFixedSections));
+    return cascade.getCoefficients(section);
+}
+
+template <typename SampleType>
+double ToneControl<SampleType>::getTailLengthSeconds(double decayDb) noexcept
+{
+    return BiquadDesign::decayTimeSeconds(kLowShelfFrequency, kShelfQ, decayDb)
+           + BiquadDesign::decayTimeSeconds(kHighShelfFrequency, kShelfQ, decayDb);
+}
+
+template <typename SampleType>
+typename ToneControl<SampleType>::ShelfPair ToneControl<SampleType>::design(float tone) const noexcept
+{
+    // Research-compliant gain range
+    constexpr float maxGainDb = 6.0f;    // Research-specified ±6dB range (was ±12dB)
+
+    // Calculate gains for tilt filter effect
+    const float gainDb = tone * maxGainDb;
+    ShelfPair pair;
+
+    // Low shelf: boost when tone is negative (darker), cut when positive (brighter)
+    const float lowGainDb = -gainDb;
+    BiquadDesign::makeLowShelf(pair[kLowShelfSection].data(), sampleRate,
+                               static_cast<SampleType>(kLowShelfFrequency), static_cast<SampleType>(kShelfQ),
+                               juce::Decibels::decibelsToGain(static_cast<SampleType>(lowGainDb)));
+
+    // High shelf: cut when tone is negative (darker), boost when positive (brighter)
+    const float highGainDb = gainDb;
+    BiquadDesign::makeHighShelf(pair[kHighShelfSection].data(), sampleRate,
+                                static_cast<SampleType>(kHighShelfFrequency), static_cast<SampleType>(kShelfQ),
+                                juce::Decibels::decibelsToGain(static_cast<SampleType>(highGainDb)));
+
+    return pair;
+}
+
+// Linear interpolation between the two nearest designs. The stable region of a biquad's
+// denominator is convex, so every blend of two stable shelves is stable too.
+template <typename SampleType>
+typename ToneControl<SampleType>::ShelfPair ToneControl<SampleType>::interpolateDesigns(float tone) const noexcept
+{
+    const float position = (juce::jlimit(-1.0f, 1.0f, tone) + 1.0f) * 0.5f * static_cast<float>(kNumDesignPoints - 1);
+    const auto lower = static_cast<size_t>(juce::jmin(static_cast<int>(position), kNumDesignPoints - 2));
+    const auto fraction = static_cast<SampleType>(position - static_cast<float>(lower));
+    ShelfPair pair;
+
+    for (size_t section = 0; section < pair.size(); ++section)
+        for (size_t k = 0; k < pair[section].size(); ++k)
+            pair[section][k] = designs[lower][section][k] + fraction * (designs[lower + 1][section][k] - designs[lower][section][k]);
+
+    return pair;
+}
+
+template <typename SampleType>
+void ToneControl<SampleType>::setCoefficients(const ShelfPair& pair) noexcept
+{
+    for (size_t section = 0; section < pair.size(); ++section)
+        std::copy(pair[section].begin(), pair[section].end(), cascade.getCoefficients(numFixedSections + static_cast<int>(section)));
+}
+
+// =============================================================================
+// Explicit instantiations for the float and double processing paths
+// =============================================================================
+
+template class StageSwitch<float>;
+template class StageSwitch<double>;
+template class WowEngine<float>;
+template class WowEngine<double>;
+template class TapeSaturation<float>;
+template class TapeSaturation<double>;
+template class ToneControl<float>;
+template class ToneControl<double>;
+}
@@ -0,0 +1,456 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "TylerAudioCommon.h"
+#include "BiquadDesign.h"
+#include "SIMDBiquad.h"
+#include "SIMDStateVariableFilter.h"
+#include "ModulatedDelay.h"
+#include "SaturationKernels.h"
+#include "SaturationTables.h"
+#include "CutFilterTables.h"
+#include "Hysteresis.h"
+#include <array>
+#include <memory>
+
+// TingeTape DSP stages. Each stage processes a whole block at a time, running a tight
+// loop over contiguous channel data, with its parameter pre-rendered per sample into a
+// control buffer by the processor. The audio path is templated on the sample type and
+// instantiated for float and double in TingeTapeDSP.cpp; control values are always float.
+namespace TylerAudio::TingeTape
+{
+    // How often the smoothed dirt, tone and wow values are advanced; the samples in between
+    // are linearly interpolated. perSample reproduces plain per-sample smoothing.
+    enum class ControlRate
+    {
+        perSample = 1,
+        every16Samples = 16,
+        every32Samples = 32
+    };
+
+    // Oversampling around the saturation's waveshaper; the value is log2 of the factor
+    enum class OversamplingFactor
+    {
+        x1 = 0,
+        x2 = 1,
+        x4 = 2,
+        x8 = 3
+    };
+
+    enum class OversamplingFilter
+    {
+        polyphaseIIR,   // Half-band polyphase IIR: low latency, non-linear phase
+        linearPhaseFIR  // Half-band equiripple FIR: linear phase, more latency
+    };
+
+    // Antiderivative anti-aliasing of the saturation's waveshaper. It costs half (first
+    // order) or one (second order) sample of group delay but needs no lookahead, so unlike
+    // oversampling it adds no reported latency.
+    enum class SaturationAntialiasing
+    {
+        none,
+        firstOrder,
+        secondOrder
+    };
+
+    // What the saturation's waveshaper models
+    enum class SaturationModel
+    {
+        tanh,       // Memoryless tanh curve, from a SaturationKernel or SaturationTable
+        hysteresis  // Jiles-Atherton tape magnetisation, which remembers the signal's past
+    };
+
+    // Filter structure of the low-cut and high-cut
+    enum class CutFilterTopology
+    {
+        biquad,        // Redesigned once per block; shares a single pass with the tone shelves
+        stateVariable  // TPT state-variable filters whose cutoff follows the smoothing every sample
+    };
+
+    // ODE solver for the hysteresis model, cheapest first
+    enum class HysteresisSolver
+    {
+        rk2,           // Explicit midpoint method, two model evaluations per sample
+        rk4,           // Classic Runge-Kutta, four model evaluations per sample
+        newtonRaphson  // Implicit trapezoidal rule, iterated to convergence within a per-block budget
+    };
+
+    // Renders a SmoothingFilter into a per-sample control buffer at the control rate. The
+    // smoother is stepped once per control interval and the ramp state carries across
+    // blocks, so control points stay evenly spaced whatever the host block size. Once the
+    // smoother has settled the rest of the block is filled with the constant.
+    class ControlRamp
+    {
+    public:
+        void reset(float value) noexcept;
+        void render(Utils::SmoothingFilter& smoother, float* destination,
+                    int numSamples, int controlInterval) noexcept;
+
+    private:
+        float currentValue{0.0f};
+        float targetValue{0.0f};
+        float increment{0.0f};
+        int samplesRemaining{0};
+    };
+
+    // Per-block on/off switch for a stage that can be skipped when neutral. Toggling starts
+    // a short linear crossfade between the stage's input and its output, which may span
+    // several blocks; the stage keeps running until a fade-out has finished.
+    template <typename SampleType>
+    class StageSwitch
+    {
+    public:
+        enum class State
+        {
+            skipped,  // Stage is off for this block
+            started,  // Stage turns on this block after being fully off
+            running   // Stage runs this block, possibly while fading
+        };
+
+        void prepare(double sampleRate, int maxBlockSize, int numChannels);
+        void reset(bool shouldBeActive) noexcept;
+
+        // Whether beginBlock() would skip the stage, for callers that arrange the block's
+        // other stages around it before calling beginBlock()
+        [[nodiscard]] bool willSkip(bool shouldBeActive) const noexcept { return ! shouldBeActive && ! isActive && fadeSamplesRemaining == 0; }
+
+        // Decides whether the stage runs for this block and, while fading, keeps its input
+        [[nodiscard]] State beginBlock(const juce::dsp::AudioBlock<SampleType>& block, bool shouldBeActive) noexcept;
+
+        // Blends the stage's output with the kept input while a crossfade is in progress
+        void endBlock(juce::dsp::AudioBlock<SampleType>& block) noexcept;
+
+    private:
+        static constexpr double kCrossfadeSeconds = 0.005;
+
+        juce::AudioBuffer<SampleType> dryBuffer;
+        float wetGain{0.0f};
+        int fadeLength{1};
+        int fadeSamplesRemaining{0};
+        bool isActive{false};
+    };
+
+    // Tape transport speed variations, rendered as a delay offset in milliseconds: wow
+    // (slow reel and capstan eccentricity), flutter (capstan and pinch roller partials)
+    // and drift (band-limited random wander). Every component is evaluated once per
+    // control interval from a sine table shared by all instances, and the sum is ramped
+    // linearly in between, so the bank costs little more per sample than a single LFO.
+    class TransportModulation
+    {
+    public:
+        static constexpr float kWowRangeMs = 45.0f;     // 0-45ms modulation range per research
+        static constexpr float kFlutterRangeMs = 0.3f;  // Peak flutter excursion at full depth
+        static constexpr float kDriftRangeMs = 2.0f;    // Peak drift excursion at full depth
+        static constexpr float kMaxOffsetMs = kWowRangeMs + kFlutterRangeMs + kDriftRangeMs;
+
+        void prepare(double sampleRate);
+        void reset() noexcept;
+        void setControlInterval(int numSamples) noexcept;
+
+        // Depths are per-sample control values in percent; a component whose depth is zero
+        // at a control point is not evaluated
+        void render(float* destination, const float* wowDepth, const float* flutterDepth,
+                    const float* driftDepth, int numSamples) noexcept;
+
+    private:
+        static constexpr double kWowFrequency = 0.5;  // Hz, research specification
+        static constexpr double kDriftRate = 0.7;     // New random drift target per second
+
+        // Capstan rotation, its second harmonic and the pinch roller, weights summing to 1
+        struct FlutterPartial
+        {
+            double frequency;
+            float weight;
+        };
+
+        static constexpr std::array<FlutterPartial, 3> kFlutterPartials{{
+            {6.2, 0.6f},
+            {12.4, 0.25f},
+            {17.7, 0.15f}
+        }};
+
+        void advance() noexcept;
+        [[nodiscard]] float evaluate(float wowDepth, float flutterDepth, float driftDepth) const noexcept;
+        [[nodiscard]] float lookupSine(double phase) const noexcept;
+
+        const float* sineTable{nullptr};
+        juce::Random random;
+
+        // Phases in cycles, [0, 1), of the next control point
+        double wowPhase{0.5};
+        std::array<double, kFlutterPartials.size()> flutterPhases{};
+        double driftPhase{0.0};
+        float driftFrom{0.0f};
+        float driftTo{0.0f};
+
+        // Phase advance per control interval
+        double wowIncrement{0.0};
+        std::array<double, kFlutterPartials.size()> flutterIncrements{};
+        double driftIncrement{0.0};
+
+        double sampleRate{44100.0};
+        float currentValue{0.0f};
+        float targetValue{0.0f};
+        float increment{0.0f};
+        int controlInterval{1};
+        int samplesRemaining{0};
+    };
+
+    // Wow modulation engine: a transport modulation bank driving a modulated delay
+    template <typename SampleType>
+    class WowEngine
+    {
+    public:
+        void prepare(double sampleRate, int maxBlockSize, int numChannels = 2);
+        void process(juce::dsp::AudioBlock<SampleType>& block, const float* wowControl,
+                     const float* flutterControl, const float* driftControl) noexcept;
+        void reset() noexcept;
+        void setInterpolation(DelayInterpolation interpolation) noexcept { delayLine.setInterpolation(interpolation); }
+        void setControlInterval(int numSamples) noexcept { modulation.setControlInterval(numSamples); }
+
+        // Heap memory held by the delay line and control buffer, in bytes
+        [[nodiscard]] size_t getMemoryUsageBytes() const noexcept;
+
+        // Feeds the delay lines without modulating while the stage is skipped, so switching
+        // wow back on crossfades into recent audio rather than stale or empty history
+        void processBypassed(const juce::dsp::AudioBlock<SampleType>& block) noexcept;
+
+        // The delay line holds up to kMaxDelayMs of past input
+        [[nodiscard]] static double getTailLengthSeconds() noexcept { return static_cast<double>(kMaxDelayMs) / 1000.0; }
+
+    private:
+        static constexpr float kBaseDelayMs = 5.0f;  // Fixed 5ms base delay per research
+        static constexpr float kMaxDelayMs = kBaseDelayMs + TransportModulation::kMaxOffsetMs;  // Longest delay at full depth
+
+        TransportModulation modulation;
+        ModulatedDelay<SampleType> delayLine;
+        std::vector<float> delayControl;  // Per-sample modulation, then delay in samples, shared by all channels
+        float sampleRate{44100.0f};
+        float maxDelaySamples{1.0f};
+        int numChannels{2};
+    };
+
+    // Tape saturation processor. The tanh waveshaper can run oversampled to keep its
+    // harmonics from aliasing; the linear HF rolloff and level compensation that follow it
+    // always run at the base rate, with channels as SIMD lanes. The tanh itself is one of
+    // the SaturationKernels, or a lookup in a shared SaturationTable. The hysteresis model
+    // replaces the tanh outright.
+    template <typename SampleType>
+    class TapeSaturation
+    {
+    public:
+        void prepare(double sampleRate, int maxBlockSize, int numChannels = 2);
+        void process(juce::dsp::AudioBlock<SampleType>& block, const float* driveControl) noexcept;
+        void reset() noexcept;
+        void setControlInterval(int numSamples) noexcept { controlInterval = juce::jmax(1, numSamples); }
+
+        void setKernel(SaturationKernel newKernel) noexcept { kernel = newKernel; }
+        [[nodiscard]] SaturationKernel getKernel() const noexcept { return kernel; }
+
+        // Replace the kernel with tables of the whole normalised curve, one per whole-percent
+        // drive, built off the audio thread as Dirt moves and crossfaded in. Until the first
+        // table arrives the kernel is used. Takes effect at the next prepare().
+        void setTransferTablesEnabled(bool shouldUseTables) noexcept { useTransferTables = shouldUseTables; }
+        [[nodiscard]] bool areTransferTablesEnabled() const noexcept { return useTransferTables; }
+        [[nodiscard]] const SaturationTable* getTransferTable() const noexcept { return activeTable; }
+
+        // Replaces the kernel and tables with exact tanh through its antiderivatives while
+        // active. Switching is allocation free.
+        void setAntialiasing(SaturationAntialiasing mode) noexcept;
+        [[nodiscard]] SaturationAntialiasing getAntialiasing() const noexcept { return antialiasing; }
+
+        // The hysteresis model replaces the kernel, tables and anti-aliasing while active.
+        // It solves an ODE at the waveshaper's rate, so it is meant to run oversampled; the
+        // remanence it leaves behind is removed by a DC blocker. Switching is allocation free
+        // and starts from demagnetised tape.
+        void setModel(SaturationModel newModel) noexcept;
+        [[nodiscard]] SaturationModel getModel() const noexcept { return model; }
+        void setHysteresisSolver(HysteresisSolver solver) noexcept { hysteresisSolver = solver; }
+        [[nodiscard]] HysteresisSolver getHysteresisSolver() const noexcept { return hysteresisSolver; }
+
+        // Solver steps spent on the last block, summed over lane groups: Runge-Kutta substeps
+        // (taken on steep edges) or Newton-Raphson iterations. Each sample gets between one
+        // and kMaxSolverSteps, within kSolverStepBudget per sample over the whole block.
+        // Those are oversampled samples, so a host block can take up to kSolverStepBudget
+        // times the oversampling factor per host sample: 24 at 8x.
+        [[nodiscard]] int getLastHysteresisSolverSteps() const noexcept { return hysteresisSolverSteps; }
+
+        static constexpr int kMaxSolverSteps = 8;
+        static constexpr int kSolverStepBudget = 3;
+
+        // Every factor and filter is built in prepare(), so switching is allocation free.
+        // A newly selected oversampler starts from a cleared state.
+        void setOversampling(OversamplingFactor factor, OversamplingFilter filter) noexcept;
+
+        // Latency added by the current oversampler, in base-rate samples
+        [[nodiscard]] int getLatencySamples() const noexcept;
+
+        // Decay time of the HF rolloff at its slowest setting, plus the hysteresis model's DC
+        // blocker when it is in use
+        [[nodiscard]] static double getTailLengthSeconds(double sampleRate, double decayDb,
+                                                         SaturationModel model = SaturationModel::tanh) noexcept;
+
+    private:
+        static constexpr int kNumOversamplingFactors = 4;
+        static constexpr int kNumOversamplingFilters = 2;
+
+        using Oversampler = juce::dsp::Oversampling<SampleType>;
+        using LaneScratch = SIMDLaneScratch<SampleType>;
+        using Register = typename LaneScratch::Register;
+
+        template <SaturationKernel Kernel>
+        void applyWaveshaper(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept;
+        void applyWaveshaper(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept;
+        void applyTransferTable(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept;
+        void applyRolloff(juce::dsp::AudioBlock<SampleType>& block, const float* driveControl) noexcept;
+        template <int Order>
+        void applyAntiderivativeWaveshaper(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept;
+        template <HysteresisSolver Solver>
+        void applyHysteresis(juce::dsp::AudioBlock<SampleType>& block, int factorLog2) noexcept;
+
+        // Indexed by filter, then by log2 of the factor; the x1 slots stay empty
+        std::array<std::array<std::unique_ptr<Oversampler>, kNumOversamplingFactors>, kNumOversamplingFilters> oversamplers;
+        Oversampler* activeOversampler{nullptr};
+        OversamplingFactor oversamplingFactor{OversamplingFactor::x1};
+        OversamplingFilter oversamplingFilter{OversamplingFilter::polyphaseIIR};
+
+        // HF rolloff state as structure of arrays: lane n of register g holds channel
+        // g * kNumLanes + n. The coefficients depend only on the drive, so they are worked
+        // out once per sample and shared by every lane.
+        std::vector<Register> rolloffStates;
+        std::vector<SampleType> rolloffCoefficients;  // Per-sample one-pole coefficient
+        std::vector<SampleType> levelCompensation;    // Per-sample output gain
+        LaneScratch laneScratch;
+        int numChannels{0};
+
+        std::vector<SampleType> driveGains;       // Per-sample 1x-10x drive gain, shared by all channels
+        std::vector<SampleType> normalisation;    // Per-sample 1 / tanh(driveGain), shared by all channels
+        SaturationKernel kernel{SaturationKernel::fastMath};
+        int controlInterval{1};
+
+        static constexpr int kTableCrossfadeSamples = 256;  // At the waveshaper's rate
+        bool useTransferTables{false};
+        std::unique_ptr<SaturationTableCache::Client> tableClient;
+        const SaturationTable* activeTable{nullptr};
+        const SaturationTable* fadingTable{nullptr};  // Table being faded out; nullptr fades out the kernel
+        int tableFadePosition{kTableCrossfadeSamples};
+
+        // Input steps below this fall back to evaluating tanh at the midpoint
+        static constexpr double kAntiderivativeTolerance = 1.0e-5;
+
+        struct AntiderivativeState
+        {
+            double previousInput{0.0};
+            double olderInput{0.0};               // Second order only
+            double previousAntiderivative{0.0};
+            double previousDifference{0.0};       // Second order only
+        };
+
+        SaturationAntialiasing antialiasing{SaturationAntialiasing::none};
+        std::vector<AntiderivativeState> antiderivativeStates;  // Per channel
+
+        static constexpr double kNewtonTolerance = 1.0e-10;
+        static constexpr double kMaxSubstepField = 0.25;  // Largest change in H per Runge-Kutta substep
+        static constexpr double kHysteresisDcCutoffHz = 10.0;
+
+        // Hysteresis state per lane group, as structure of arrays like the rolloff. The
+        // model needs tanh, which SIMDRegister lacks, so the lanes are plain loops.
+        using LaneValues = std::array<double, static_cast<size_t>(LaneScratch::kNumLanes)>;
+
+        struct HysteresisState
+        {
+            LaneValues magnetisation{};
+            LaneValues field{};
+            LaneValues dcInput{};
+            LaneValues dcOutput{};
+        };
+
+        SaturationModel model{SaturationModel::tanh};
+        HysteresisSolver hysteresisSolver{HysteresisSolver::rk2};
+        std::vector<HysteresisState> hysteresisStates;
+        LaneScratch hysteresisScratch;  // Sized for the highest oversampling factor
+        double sampleRate{44100.0};
+        int hysteresisSolverSteps{0};
+
+        // Research-compliant constants
+        static constexpr SampleType kHighFreqRolloff = SampleType(0.9);  // Base rolloff, increases with drive
+    };
+
+    // Tone control (tilt filter). Up to kMaxFixedSections fixed biquads can run ahead of
+    // the shelves in the same SIMD cascade, enough for the processor's low-cut and high-cut
+    // both at 48 dB/oct, so neighbouring linear stages take a single pass over the block.
+    // Linear filters commute, so their order relative to the shelves does not change the
+    // result.
+    template <typename SampleType>
+    class ToneControl
+    {
+    public:
+        static constexpr int kMaxFixedSections = 8;
+
+        void prepare(double sampleRate, int maxBlockSize, int numChannels = 2, int numFixedSections = 0);
+
+        // Runs the fixed sections from firstFixedSection on, then the shelves
+        void process(juce::dsp::AudioBlock<SampleType>& block, const float* toneControl, int firstFixedSection = 0) noexcept;
+
+        // Runs fixed sections only: ahead of a nonlinear stage, or while the tone is neutral
+        void processFixed(juce::dsp::AudioBlock<SampleType>& block, int firstFixedSection, int count) noexcept;
+
+        void reset() noexcept;
+
+        // Clears the shelves only, e.g. when the tone stage comes back in, and starts them
+        // from the next tone value instead of ramping from a stale one
+        void resetShelves() noexcept;
+
+        // Clears the fixed sections only, leaving the shelves ringing
+        void resetFixedSections() noexcept;
+        void resetFixedSections(int firstFixedSection, int count) noexcept;
+
+        [[nodiscard]] int getNumFixedSections() const noexcept { return numFixedSections; }
+
+        // Grows or shrinks the fixed run ahead of the shelves, which move with it and keep
+        // ringing. Sections coming into use keep stale coefficients and state until written
+        // and cleared.
+        void setNumFixedSections(int newNumFixedSections) noexcept;
+
+        // Moves count fixed sections' coefficients and state to start at destination
+        void moveFixedSections(int firstFixedSection, int destination, int count) noexcept;
+
+        void setControlInterval(int numSamples) noexcept;
+
+        // Storage for a fixed section's normalised {b0, b1, b2, a1, a2}, written in place
+        [[nodiscard]] SampleType* getFixedCoefficients(int section) noexcept;
+
+        // Combined ring time of both shelves
+        [[nodiscard]] static double getTailLengthSeconds(double decayDb) noexcept;
+
+    private:
+        static constexpr int kLowShelfSection = 0;
+        static constexpr int kHighShelfSection = 1;
+        static constexpr float kLowShelfFrequency = 250.0f;    // Low shelf frequency per research
+        static constexpr float kHighShelfFrequency = 5000.0f;  // High shelf frequency per research
+        static constexpr float kShelfQ = 0.707f;
+
+        // Shelf pairs designed in prepare() at evenly spaced tone settings. A moving Tone
+        // interpolates between neighbouring designs at each control point, and the shelves
+        // ramp to the result sample by sample, so automation never redesigns or steps.
+        static constexpr int kNumDesignPoints = 65;  // Tone steps of 1/32
+        static constexpr int kMinRampLength = 16;    // Keeps per-sample control from setting up a ramp every sample
+        using SectionCoefficients = typename SIMDBiquadCascade<SampleType>::SectionCoefficients;
+        using ShelfPair = std::array<SectionCoefficients, 2>;  // Indexed by section
+
+        SIMDBiquadCascade<SampleType> cascade;  // Fixed sections, then low and high shelf, over all channels
+        std::array<ShelfPair, kNumDesignPoints> designs{};
+        std::vector<SectionCoefficients> rampTargets;  // Each ramp's coefficients for every section processed
+        ShelfPair currentDesign{};
+        float currentTone{0.0f};
+        double sampleRate{44100.0};
+        int rampLength{kMinRampLength};  // Whole control intervals, so ramps end on control points
+        int samplesUntilUpdate{0};       // Samples left before the next ramp starts
+        int numFixedSections{0};
+        bool snapToTone{true};           // After a reset there is no history to ramp from
+
+        [[nodiscard]] ShelfPair design(float tone) const noexcept;
+        [[nodiscard]] ShelfPair interpolateDesigns(float tone) const noexcept;
+        void setCoefficients(const ShelfPair& pair) noexcept;
+    };
+}
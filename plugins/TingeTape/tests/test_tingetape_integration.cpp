@@ -376,4 +376,198 @@ TEST_CASE("TingeTape Integration Tests", "[TingeTape][integration]")
             }
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("TingeTape silence detection and tail", "[TingeTape][integration]")
+{
+    const double sampleRate = 48000.0;
+    const int blockSize = 256;
+
+    TingeTapeAudioProcessor processor;
+    processor.prepareToPlay(sampleRate, blockSize);
+
+    auto setParameter = [&processor](const char* parameterID, float value)
+    {
+        if (auto* parameter = processor.getParameters().getParameter(parameterID))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    };
+
+    // No wow, so the first block after silence is not held back by the modulated delay
+    setParameter(TylerAudio::ParameterIDs::kWow, 0.0f);
+    setParameter(TylerAudio::ParameterIDs::kDirt, 30.0f);
+    setParameter(TylerAudio::ParameterIDs::kLowCutRes, 1.5f);
+
+    const double tailSeconds = processor.getTailLengthSeconds();
+
+    SECTION("Tail covers the wow delay and the filter ring")
+    {
+        REQUIRE(tailSeconds > 0.05);  // At least the 50 ms the wow delay lines can hold
+        REQUIRE(tailSeconds < 2.0);
+    }
+
+    SECTION("Output decays to exact silence and resumes with the signal")
+    {
+        const auto tone = generateTestTone(440.0f, 0.5f, sampleRate, blockSize, 2);
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midiBuffer;
+
+        auto processSignal = [&]
+        {
+            for (int ch = 0; ch < 2; ++ch)
+                buffer.copyFrom(ch, 0, tone, ch, 0, blockSize);
+            processor.processBlock(buffer, midiBuffer);
+        };
+
+        auto processSilence = [&]
+        {
+            buffer.clear();
+            processor.processBlock(buffer, midiBuffer);
+        };
+
+        for (int block = 0; block < 50; ++block)
+            processSignal();
+
+        // The filters are still ringing right after the input stops
+        processSilence();
+        REQUIRE(buffer.getMagnitude(0, blockSize) > 0.0f);
+
+        // Once the tail has passed the chain goes idle and outputs exact silence
+        const int tailBlocks = static_cast<int>(std::ceil(tailSeconds * sampleRate / blockSize)) + 1;
+        for (int block = 0; block < tailBlocks; ++block)
+            processSilence();
+
+        for (int block = 0; block < 20; ++block)
+        {
+            processSilence();
+            REQUIRE(buffer.getMagnitude(0, blockSize) == 0.0f);
+            REQUIRE(buffer.getMagnitude(1, blockSize) == 0.0f);
+        }
+
+        // Signal coming back is processed straight away
+        processSignal();
+        REQUIRE(buffer.getMagnitude(0, blockSize) > 0.01f);
+        REQUIRE_FALSE(hasInvalidValues(buffer));
+    }
+}
+
+TEST_CASE("TingeTape neutral stage bypass", "[TingeTape][integration]")
+{
+    const double sampleRate = 48000.0;
+    const int blockSize = 128;
+
+    TingeTapeAudioProcessor processor;
+    processor.prepareToPlay(sampleRate, blockSize);
+
+    auto setParameter = [&processor](const char* parameterID, float value)
+    {
+        if (auto* parameter = processor.getParameters().getParameter(parameterID))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    };
+
+    setParameter(TylerAudio::ParameterIDs::kDirt, 0.0f);
+    setParameter(TylerAudio::ParameterIDs::kTone, 0.0f);
+    setParameter(TylerAudio::ParameterIDs::kWow, 0.0f);
+
+    // A quiet low sine moves at most ~0.0007 per sample and stays small even when fully
+    // driven, so anything much larger is a click
+    const int numSamples = static_cast<int>(sampleRate);
+    const auto sine = generateTestTone(50.0f, 0.1f, sampleRate, numSamples, 2);
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midiBuffer;
+    float previousSample = 0.0f;
+    float maxStep = 0.0f;
+    int position = 0;
+
+    auto processFor = [&](double seconds)
+    {
+        for (int processed = 0; processed < static_cast<int>(seconds * sampleRate); processed += blockSize)
+        {
+            for (int ch = 0; ch < 2; ++ch)
+                buffer.copyFrom(ch, 0, sine, ch, position, blockSize);
+
+            processor.processBlock(buffer, midiBuffer);
+            position = (position + blockSize) % (numSamples - blockSize);
+
+            for (int i = 0; i < blockSize; ++i)
+            {
+                const float sample = buffer.getSample(0, i);
+                maxStep = juce::jmax(maxStep, std::abs(sample - previousSample));
+                previousSample = sample;
+            }
+        }
+    };
+
+    // Let the filters settle before measuring
+    processFor(0.2);
+    maxStep = 0.0f;
+
+    // Saturation and tone are not identity at their first non-neutral step, so switching
+    // them in and out relies on the crossfade to stay click free
+    for (const auto* parameterID : {TylerAudio::ParameterIDs::kDirt, TylerAudio::ParameterIDs::kTone})
+    {
+        setParameter(parameterID, 80.0f);
+        processFor(0.3);
+        setParameter(parameterID, 0.0f);
+        processFor(0.5);
+    }
+
+    INFO("Largest sample-to-sample step: " << maxStep);
+    REQUIRE(maxStep < 0.01f);
+    REQUIRE_FALSE(hasInvalidValues(buffer));
+}
+
+TEST_CASE("TingeTape multichannel layouts", "[TingeTape][integration]")
+{
+    TingeTapeAudioProcessor processor;
+
+    auto makeLayout = [](const juce::AudioChannelSet& channelSet)
+    {
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add(channelSet);
+        layout.outputBuses.add(channelSet);
+        return layout;
+    };
+
+    SECTION("Named and discrete layouts up to 16 channels are accepted")
+    {
+        REQUIRE(processor.checkBusesLayoutSupported(makeLayout(juce::AudioChannelSet::mono())));
+        REQUIRE(processor.checkBusesLayoutSupported(makeLayout(juce::AudioChannelSet::stereo())));
+        REQUIRE(processor.checkBusesLayoutSupported(makeLayout(juce::AudioChannelSet::create5point1())));
+        REQUIRE(processor.checkBusesLayoutSupported(makeLayout(juce::AudioChannelSet::create7point1point4())));
+        REQUIRE(processor.checkBusesLayoutSupported(makeLayout(juce::AudioChannelSet::discreteChannels(16))));
+        REQUIRE_FALSE(processor.checkBusesLayoutSupported(makeLayout(juce::AudioChannelSet::discreteChannels(17))));
+    }
+
+    SECTION("All channels of a 7.1.4 bus share the same wow and filtering")
+    {
+        const double sampleRate = 48000.0;
+        const int blockSize = 256;
+        const auto layout = makeLayout(juce::AudioChannelSet::create7point1point4());
+        const int numChannels = layout.getMainOutputChannelSet().size();
+
+        REQUIRE(processor.setBusesLayout(layout));
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        if (auto* parameter = processor.getParameters().getParameter(TylerAudio::ParameterIDs::kWow))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(100.0f));
+
+        // The same signal on every channel must come out identical on every channel
+        const auto tone = generateTestTone(440.0f, 0.5f, sampleRate, blockSize, 1);
+        juce::AudioBuffer<float> buffer(numChannels, blockSize);
+        juce::MidiBuffer midiBuffer;
+
+        for (int block = 0; block < 100; ++block)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                buffer.copyFrom(ch, 0, tone, 0, 0, blockSize);
+
+            processor.processBlock(buffer, midiBuffer);
+        }
+
+        REQUIRE(buffer.getMagnitude(0, blockSize) > 0.01f);
+        REQUIRE_FALSE(hasInvalidValues(buffer));
+
+        for (int ch = 1; ch < numChannels; ++ch)
+            for (int i = 0; i < blockSize; ++i)
+                REQUIRE(buffer.getSample(ch, i) == buffer.getSample(0, i));
+    }
+}
@@ -3,12 +3,261 @@
 #include <JuceHeader.h>
 #include "audio_test_utils.h"
 #include "../Source/PluginProcessor.h"
+#include <algorithm>
 #include <chrono>
+#include <limits>
+#include <utility>
 #include <vector>
 
 using namespace TylerAudio::Testing;
 using Catch::Approx;
 
+namespace
+{
+    void setParameterValue(TingeTapeAudioProcessor& processor, const char* parameterID, float value)
+    {
+        if (auto* parameter = processor.getParameters().getParameter(parameterID))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    }
+
+    // Reference copy of the original per-sample TingeTape chain, kept as the "before"
+    // baseline for the block pipeline benchmark
+    class LegacyPerSampleChain
+    {
+    public:
+        void prepare(double newSampleRate, int blockSize, int numChannels, float dirt, float tone, float wow)
+        {
+            sampleRate = newSampleRate;
+            const juce::dsp::ProcessSpec spec{sampleRate, static_cast<juce::uint32>(blockSize),
+                                              static_cast<juce::uint32>(numChannels)};
+
+            lowCutFilter.prepare(spec);
+            highCutFilter.prepare(spec);
+            *lowCutFilter.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, 40.0f, 0.707f);
+            *highCutFilter.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, 15000.0f, 0.707f);
+
+            const juce::dsp::ProcessSpec monoSpec{sampleRate, static_cast<juce::uint32>(blockSize), 1};
+            lowShelf.prepare(monoSpec);
+            highShelf.prepare(monoSpec);
+
+            delayLines.resize(static_cast<size_t>(numChannels));
+            for (auto& delayLine : delayLines)
+            {
+                delayLine.setMaximumDelayInSamples(static_cast<int>(sampleRate * 0.05));
+                delayLine.prepare(monoSpec);
+            }
+
+            lfo.prepare(monoSpec);
+            lfo.setFrequency(0.5f);
+            lfo.initialise([](float x) { return std::sin(x); }, 128);
+
+            for (auto* smoother : {&dirtSmoother, &toneSmoother, &wowSmoother})
+                smoother->setSmoothingTime(0.03, sampleRate);
+
+            dirtSmoother.setTargetValue(dirt);
+            toneSmoother.setTargetValue(tone);
+            wowSmoother.setTargetValue(wow);
+            dirtSmoother.snapToTarget();
+            toneSmoother.snapToTarget();
+            wowSmoother.snapToTarget();
+        }
+
+        void process(juce::AudioBuffer<float>& buffer)
+        {
+            auto block = juce::dsp::AudioBlock<float>(buffer);
+            juce::dsp::ProcessContextReplacing<float> context(block);
+            lowCutFilter.process(context);
+
+            for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
+            {
+                setDrive(dirtSmoother.getNextValue());
+                setTone(toneSmoother.getNextValue());
+                depth = juce::jlimit(0.0f, 100.0f, wowSmoother.getNextValue()) / 100.0f;
+
+                for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+                {
+                    float value = block.getSample(static_cast<int>(channel), sample);
+                    value = saturate(value);
+
+                    if (std::abs(currentTone) > 0.001f)
+                        value = highShelf.processSample(lowShelf.processSample(value));
+
+                    value = applyWow(value, static_cast<int>(channel));
+                    block.setSample(static_cast<int>(channel), sample, TylerAudio::Utils::sanitizeFloat(value));
+                }
+            }
+
+            highCutFilter.process(context);
+        }
+
+    private:
+        using Duplicator = juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
+                                                          juce::dsp::IIR::Coefficients<float>>;
+
+        void setDrive(float value) { drive = juce::jlimit(0.0f, 100.0f, value) / 100.0f; }
+
+        void setTone(float value)
+        {
+            const float newTone = juce::jlimit(-100.0f, 100.0f, value) / 100.0f;
+            if (std::abs(newTone - currentTone) <= 0.001f)
+                return;
+
+            currentTone = newTone;
+            const float gainDb = currentTone * 6.0f;
+            *lowShelf.coefficients = *juce::dsp::IIR::Coefficients<float>::makeLowShelf(
+                sampleRate, 250.0f, 0.707f, juce::Decibels::decibelsToGain(-gainDb));
+            *highShelf.coefficients = *juce::dsp::IIR::Coefficients<float>::makeHighShelf(
+                sampleRate, 5000.0f, 0.707f, juce::Decibels::decibelsToGain(gainDb));
+        }
+
+        float saturate(float input)
+        {
+            if (drive <= 0.001f)
+                return input;
+
+            const float driveGain = 1.0f + drive * 9.0f;
+            float value = std::tanh(input * driveGain) / std::tanh(driveGain);
+            const float alpha = juce::jlimit(0.1f, 0.98f, 0.9f + drive * 0.08f);
+            previousSample = alpha * previousSample + (1.0f - alpha) * value;
+            value = previousSample / (1.0f + drive * 0.5f);
+
+            if (std::fpclassify(value) == FP_SUBNORMAL)
+                value = 0.0f;
+
+            return value;
+        }
+
+        float applyWow(float input, int channel)
+        {
+            if (depth <= 0.001f)
+                return input;
+
+            const float lfoValue = lfo.processSample(0.0f);
+            const float srFloat = static_cast<float>(sampleRate);
+            const float delaySamples = (5.0f + lfoValue * depth * 45.0f) * srFloat / 1000.0f;
+            auto& delayLine = delayLines[static_cast<size_t>(channel)];
+            delayLine.setDelay(juce::jlimit(1.0f, srFloat * 0.05f - 1.0f, delaySamples));
+            delayLine.pushSample(0, input);
+            return delayLine.popSample(0);
+        }
+
+        double sampleRate{48000.0};
+        Duplicator lowCutFilter;
+        Duplicator highCutFilter;
+        juce::dsp::IIR::Filter<float> lowShelf;
+        juce::dsp::IIR::Filter<float> highShelf;
+        std::vector<juce::dsp::DelayLine<float>> delayLines;
+        juce::dsp::Oscillator<float> lfo;
+        TylerAudio::Utils::SmoothingFilter dirtSmoother;
+        TylerAudio::Utils::SmoothingFilter toneSmoother;
+        TylerAudio::Utils::SmoothingFilter wowSmoother;
+        float drive{0.0f};
+        float currentTone{0.0f};
+        float depth{0.0f};
+        float previousSample{0.0f};
+    };
+
+    // The wow stage's delay curve as rendered before the transport modulation bank: one
+    // 0.5 Hz sine evaluated per sample with a 9th order polynomial, scaled by the depth.
+    // Kept as the cost baseline for the modulation bank benchmark.
+    class LegacyWowCurve
+    {
+    public:
+        explicit LegacyWowCurve(double sampleRate)
+            : increment(0.5 / sampleRate),
+              samplesPerMs(static_cast<float>(sampleRate / 1000.0)),
+              maxDelaySamples(50.0f * samplesPerMs)
+        {
+        }
+
+        void render(float* delay, const float* depthControl, int numSamples) noexcept
+        {
+            const auto startPhase = static_cast<float>(phase);
+            const auto phaseIncrement = static_cast<float>(increment);
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                float p = startPhase + phaseIncrement * static_cast<float>(i);
+                p -= p >= 1.0f ? 1.0f : 0.0f;
+
+                float t = 0.5f - p;
+                t = t > 0.25f ? 0.5f - t : (t < -0.25f ? -0.5f - t : t);
+                const float x = juce::MathConstants<float>::twoPi * t;
+                const float x2 = x * x;
+                const float lfo = x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 * (-1.0f / 5040.0f + x2 * (1.0f / 362880.0f)))));
+
+                const float depth = juce::jlimit(0.0f, 100.0f, depthControl[i]) / 100.0f;
+                delay[i] = juce::jlimit(1.0f, maxDelaySamples - 1.0f, (5.0f + lfo * depth * 45.0f) * samplesPerMs);
+            }
+
+            phase += increment * numSamples;
+            phase -= std::floor(phase);
+        }
+
+    private:
+        double phase{0.5};
+        double increment;
+        float samplesPerMs;
+        float maxDelaySamples;
+    };
+
+    // Goertzel magnitude of one frequency over part of a channel
+    double goertzelMagnitude(const juce::AudioBuffer<float>& buffer, int channel, int start, int length,
+                             double frequency, double sampleRate)
+    {
+        const double coefficient = 2.0 * std::cos(juce::MathConstants<double>::twoPi * frequency / sampleRate);
+        double s1 = 0.0;
+        double s2 = 0.0;
+
+        for (int i = 0; i < length; ++i)
+        {
+            const double s0 = static_cast<double>(buffer.getSample(channel, start + i)) + coefficient * s1 - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        return std::sqrt(s1 * s1 + s2 * s2 - coefficient * s1 * s2);
+    }
+
+    // Processes totalSamples of the source signal in blockSize chunks and returns the elapsed time
+    template <typename SampleType, typename ProcessFunction>
+    double measureProcessingTimeMs(ProcessFunction&& process,
+                                   const juce::AudioBuffer<SampleType>& source,
+                                   int blockSize,
+                                   int totalSamples)
+    {
+        juce::AudioBuffer<SampleType> buffer(source.getNumChannels(), blockSize);
+
+        PerformanceTimer timer;
+        timer.start();
+
+        for (int position = 0; position + blockSize <= totalSamples; position += blockSize)
+        {
+            const int sourceOffset = position % (source.getNumSamples() - blockSize);
+
+            for (int ch = 0; ch < source.getNumChannels(); ++ch)
+                buffer.copyFrom(ch, 0, source, ch, sourceOffset, blockSize);
+
+            process(buffer);
+        }
+
+        return timer.getElapsedMilliseconds();
+    }
+
+    // Checks that afterMs beats beforeMs by at least minSpeedup; a minSpeedup below 1 bounds
+    // how much slower it may be instead. Timing comparisons are only meaningful in
+    // optimised builds, so other builds only report the measurements.
+    void checkSpeedup(double afterMs, double beforeMs, double minSpeedup = 1.0)
+    {
+        INFO("Before " << beforeMs << "ms, after " << afterMs << "ms, required speedup " << minSpeedup << "x");
+#ifdef NDEBUG
+        CHECK(afterMs * minSpeedup <= beforeMs);
+#else
+        juce::ignoreUnused(afterMs, beforeMs, minSpeedup);
+#endif
+    }
+}
+
 TEST_CASE("TingeTape Performance Tests", "[TingeTape][performance]")
 {
     SECTION("CPU usage measurement - <1% at 48kHz/512 samples")
@@ -304,4 +553,1274 @@ TEST_CASE("TingeTape Performance Tests", "[TingeTape][performance]")
         // Consistency requirement - variation should not be excessive
         REQUIRE((maxTime - minTime) < avgTime * 2.0);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("TingeTape block pipeline benchmark", "[TingeTape][performance][benchmark]")
+{
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;  // 5 seconds of audio per measurement
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+
+    const float dirt = 50.0f;
+    const float tone = 30.0f;
+    const float wow = 25.0f;
+
+    auto source = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+
+    for (const int blockSize : {32, 64, 512})
+    {
+        LegacyPerSampleChain legacy;
+        legacy.prepare(sampleRate, blockSize, numChannels, dirt, tone, wow);
+
+        TingeTapeAudioProcessor processor;
+        processor.prepareToPlay(sampleRate, blockSize);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kDirt, dirt);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kTone, tone);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kWow, wow);
+
+        juce::MidiBuffer midiBuffer;
+        auto processLegacy = [&](juce::AudioBuffer<float>& buffer) { legacy.process(buffer); };
+        auto processBlockPipeline = [&](juce::AudioBuffer<float>& buffer) { processor.processBlock(buffer, midiBuffer); };
+
+        // Warm up both paths (and let the smoothers settle) before measuring
+        measureProcessingTimeMs(processLegacy, source, blockSize, static_cast<int>(sampleRate));
+        measureProcessingTimeMs(processBlockPipeline, source, blockSize, static_cast<int>(sampleRate));
+
+        const double beforeMs = measureProcessingTimeMs(processLegacy, source, blockSize, totalSamples);
+        const double afterMs = measureProcessingTimeMs(processBlockPipeline, source, blockSize, totalSamples);
+
+        WARN("Block size " << blockSize
+             << ": per-sample chain " << (beforeMs / audioDurationMs * 100.0) << "% CPU, "
+             << "block pipeline " << (afterMs / audioDurationMs * 100.0) << "% CPU, "
+             << "speedup " << (beforeMs / afterMs) << "x");
+
+        INFO("Block size: " << blockSize);
+        checkSpeedup(afterMs, beforeMs);
+        REQUIRE(afterMs > 0.0);
+        REQUIRE(afterMs < audioDurationMs);  // Must run faster than realtime at every block size
+    }
+}
+
+TEST_CASE("TingeTape SIMD filter stage benchmark", "[TingeTape][performance][benchmark]")
+{
+    using namespace TylerAudio::TingeTape;
+    using ScalarFilter = juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
+                                                        juce::dsp::IIR::Coefficients<float>>;
+
+    const double sampleRate = 48000.0;
+    const int blockSize = 512;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+
+    for (const int numChannels : {2, 8})
+    {
+        auto source = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+        const juce::dsp::ProcessSpec spec{sampleRate, static_cast<juce::uint32>(blockSize),
+                                          static_cast<juce::uint32>(numChannels)};
+
+        // Before: one scalar IIR per channel and per section (low cut, two shelves, high cut)
+        ScalarFilter lowCut, lowShelf, highShelf, highCut;
+        *lowCut.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, 40.0f, 0.707f);
+        *lowShelf.state = *juce::dsp::IIR::Coefficients<float>::makeLowShelf(sampleRate, 250.0f, 0.707f, 0.7f);
+        *highShelf.state = *juce::dsp::IIR::Coefficients<float>::makeHighShelf(sampleRate, 5000.0f, 0.707f, 1.4f);
+        *highCut.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, 15000.0f, 0.707f);
+
+        for (auto* filter : {&lowCut, &lowShelf, &highShelf, &highCut})
+            filter->prepare(spec);
+
+        // After: one SIMD cascade, laid out as ToneControl runs the stage: the cut sections
+        // ahead of the shelves, all in a single pass over the block
+        SIMDBiquadCascade<float> simdCascade;
+        simdCascade.prepare(blockSize, numChannels, 4);
+        BiquadDesign::makeHighPass(simdCascade.getCoefficients(0), sampleRate, 40.0f, 0.707f);
+        BiquadDesign::makeLowPass(simdCascade.getCoefficients(1), sampleRate, 15000.0f, 0.707f);
+        BiquadDesign::makeLowShelf(simdCascade.getCoefficients(2), sampleRate, 250.0f, 0.707f, 0.7f);
+        BiquadDesign::makeHighShelf(simdCascade.getCoefficients(3), sampleRate, 5000.0f, 0.707f, 1.4f);
+
+        auto processScalar = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+            juce::dsp::ProcessContextReplacing<float> context(block);
+            lowCut.process(context);
+            lowShelf.process(context);
+            highShelf.process(context);
+            highCut.process(context);
+        };
+
+        auto processSIMD = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+            simdCascade.process(block);
+        };
+
+        // Both paths must produce the same output from the same initial state
+        {
+            juce::AudioBuffer<float> scalarOutput(numChannels, blockSize);
+            juce::AudioBuffer<float> simdOutput(numChannels, blockSize);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                scalarOutput.copyFrom(ch, 0, source, ch, 0, blockSize);
+                simdOutput.copyFrom(ch, 0, source, ch, 0, blockSize);
+            }
+
+            processScalar(scalarOutput);
+            processSIMD(simdOutput);
+
+            float maxDifference = 0.0f;
+            for (int ch = 0; ch < numChannels; ++ch)
+                for (int i = 0; i < blockSize; ++i)
+                    maxDifference = juce::jmax(maxDifference,
+                                               std::abs(scalarOutput.getSample(ch, i) - simdOutput.getSample(ch, i)));
+
+            INFO("Channels: " << numChannels);
+            REQUIRE(maxDifference < 1.0e-4f);
+        }
+
+        const double scalarMs = measureProcessingTimeMs(processScalar, source, blockSize, totalSamples);
+        const double simdMs = measureProcessingTimeMs(processSIMD, source, blockSize, totalSamples);
+
+        WARN(numChannels << " channels, " << SIMDBiquadCascade<float>::kNumLanes << " lanes: "
+             << "scalar filters " << scalarMs << "ms, SIMD cascade " << simdMs << "ms, "
+             << "speedup " << (scalarMs / simdMs) << "x");
+
+        REQUIRE(simdMs > 0.0);
+        checkSpeedup(simdMs, scalarMs, 2.0);
+    }
+}
+
+TEST_CASE("TingeTape fused filter cascade benchmark", "[TingeTape][performance][benchmark]")
+{
+    using namespace TylerAudio::TingeTape;
+
+    // Low-cut, tone shelves and high-cut as three passes over the buffer, against the
+    // single cascade the processor runs while Dirt is off. Large blocks no longer fit in
+    // cache, so the passes become memory bound; traffic counts each pass reading and
+    // writing every sample once.
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int totalSamples = static_cast<int>(sampleRate) * 10;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const std::vector<float> tone(static_cast<size_t>(16384), 40.0f);
+
+    for (const int blockSize : {1024, 4096, 16384})
+    {
+        const auto source = generateWhiteNoise(0.5f, blockSize * 4, numChannels);
+
+        // Before: a pass each
+        SIMDBiquadCascade<float> lowCut, highCut;
+        ToneControl<float> shelves;
+        lowCut.prepare(blockSize, numChannels);
+        highCut.prepare(blockSize, numChannels);
+        shelves.prepare(sampleRate, blockSize, numChannels);
+        BiquadDesign::makeHighPass(lowCut.getCoefficients(0), sampleRate, 40.0f, 0.707f);
+        BiquadDesign::makeLowPass(highCut.getCoefficients(0), sampleRate, 15000.0f, 0.707f);
+
+        // After: the cut filters as the tone control's fixed sections
+        ToneControl<float> fused;
+        fused.prepare(sampleRate, blockSize, numChannels, 2);
+        BiquadDesign::makeHighPass(fused.getFixedCoefficients(0), sampleRate, 40.0f, 0.707f);
+        BiquadDesign::makeLowPass(fused.getFixedCoefficients(1), sampleRate, 15000.0f, 0.707f);
+
+        auto processSeparate = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+            lowCut.process(block);
+            shelves.process(block, tone.data());
+            highCut.process(block);
+        };
+
+        auto processFused = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+            fused.process(block, tone.data());
+        };
+
+        // Linear stages commute, so both orders give the same output
+        {
+            juce::AudioBuffer<float> separateOutput(numChannels, blockSize);
+            juce::AudioBuffer<float> fusedOutput(numChannels, blockSize);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                separateOutput.copyFrom(ch, 0, source, ch, 0, blockSize);
+                fusedOutput.copyFrom(ch, 0, source, ch, 0, blockSize);
+            }
+
+            processSeparate(separateOutput);
+            processFused(fusedOutput);
+
+            float maxDifference = 0.0f;
+            for (int ch = 0; ch < numChannels; ++ch)
+                for (int i = 0; i < blockSize; ++i)
+                    maxDifference = juce::jmax(maxDifference,
+                                               std::abs(separateOutput.getSample(ch, i) - fusedOutput.getSample(ch, i)));
+
+            INFO("Block size: " << blockSize);
+            REQUIRE(maxDifference < 1.0e-4f);
+        }
+
+        measureProcessingTimeMs(processSeparate, source, blockSize, static_cast<int>(sampleRate));
+        measureProcessingTimeMs(processFused, source, blockSize, static_cast<int>(sampleRate));
+
+        const double separateMs = measureProcessingTimeMs(processSeparate, source, blockSize, totalSamples);
+        const double fusedMs = measureProcessingTimeMs(processFused, source, blockSize, totalSamples);
+
+        // Megabytes moved between the buffer and the filters per second of audio
+        const auto trafficPerPassMB = 2.0 * numChannels * sampleRate * sizeof(float) / (1024.0 * 1024.0);
+
+        WARN("Block size " << blockSize << ": three passes " << (separateMs / audioDurationMs * 100.0) << "% CPU, "
+             << (3.0 * trafficPerPassMB) << " MB/s; one pass " << (fusedMs / audioDurationMs * 100.0) << "% CPU, "
+             << trafficPerPassMB << " MB/s; speedup " << (separateMs / fusedMs) << "x");
+
+        INFO("Block size: " << blockSize);
+        REQUIRE(fusedMs > 0.0);
+        checkSpeedup(fusedMs, separateMs);
+    }
+}
+
+TEST_CASE("TingeTape cut filter slope benchmark", "[TingeTape][performance][benchmark]")
+{
+    using namespace TylerAudio::TingeTape;
+
+    // Both cut filters at each slope, with the tone shelves between them: one cascade
+    // pass, against a pass per section as a chain of separate biquads would run them.
+    // Each extra 12 dB/oct adds a section to each filter.
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 512;
+    const int totalSamples = static_cast<int>(sampleRate) * 10;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const std::vector<float> tone(static_cast<size_t>(blockSize), 40.0f);
+    const auto source = generateWhiteNoise(0.5f, blockSize * 4, numChannels);
+    double gentlestMs = 0.0;
+
+    for (int numSections = 1; numSections <= BiquadDesign::kMaxCascadeSections; ++numSections)
+    {
+        ToneControl<float> shelves, fused;
+        std::vector<SIMDBiquadCascade<float>> separate(static_cast<size_t>(2 * numSections));
+        shelves.prepare(sampleRate, blockSize, numChannels);
+        fused.prepare(sampleRate, blockSize, numChannels, 2 * numSections);
+
+        for (int section = 0; section < numSections; ++section)
+        {
+            const auto q = static_cast<float>(BiquadDesign::resonantSectionQ(numSections, section, 0.707));
+            auto& lowCut = separate[static_cast<size_t>(section)];
+            auto& highCut = separate[static_cast<size_t>(numSections + section)];
+            lowCut.prepare(blockSize, numChannels);
+            highCut.prepare(blockSize, numChannels);
+            BiquadDesign::makeHighPass(lowCut.getCoefficients(0), sampleRate, 40.0f, q);
+            BiquadDesign::makeLowPass(highCut.getCoefficients(0), sampleRate, 15000.0f, q);
+            BiquadDesign::makeHighPass(fused.getFixedCoefficients(section), sampleRate, 40.0f, q);
+            BiquadDesign::makeLowPass(fused.getFixedCoefficients(numSections + section), sampleRate, 15000.0f, q);
+        }
+
+        auto processSeparate = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+
+            for (int section = 0; section < numSections; ++section)
+                separate[static_cast<size_t>(section)].process(block);
+
+            shelves.process(block, tone.data());
+
+            for (int section = numSections; section < 2 * numSections; ++section)
+                separate[static_cast<size_t>(section)].process(block);
+        };
+
+        auto processFused = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+            fused.process(block, tone.data());
+        };
+
+        measureProcessingTimeMs(processSeparate, source, blockSize, static_cast<int>(sampleRate));
+        measureProcessingTimeMs(processFused, source, blockSize, static_cast<int>(sampleRate));
+
+        const double separateMs = measureProcessingTimeMs(processSeparate, source, blockSize, totalSamples);
+        const double fusedMs = measureProcessingTimeMs(processFused, source, blockSize, totalSamples);
+
+        if (numSections == 1)
+            gentlestMs = fusedMs;
+
+        WARN(12 * numSections << " dB/oct: " << (2 * numSections + 2) << " sections in one pass "
+             << (fusedMs / audioDurationMs * 100.0) << "% CPU, a pass each " << (separateMs / audioDurationMs * 100.0)
+             << "% CPU; " << (fusedMs / gentlestMs) << "x the 12 dB/oct cost");
+
+        INFO("Sections per filter: " << numSections);
+        REQUIRE(fusedMs > 0.0);
+        checkSpeedup(fusedMs, separateMs);
+        checkSpeedup(fusedMs, gentlestMs * (numSections + 1) / 2.0 * 1.25);
+    }
+}
+
+TEST_CASE("TingeTape control rate benchmark", "[TingeTape][performance][benchmark]")
+{
+    using TylerAudio::TingeTape::ControlRate;
+
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 256;
+    const int numBlocks = static_cast<int>(sampleRate) * 5 / blockSize;
+    const double audioDurationMs = numBlocks * blockSize * 1000.0 / sampleRate;
+
+    auto source = generateWhiteNoise(0.5f, blockSize * 16, numChannels);
+
+    // Renders the same continuously automated signal at a given control rate
+    auto render = [&](ControlRate rate, double& elapsedMs)
+    {
+        TingeTapeAudioProcessor processor;
+        processor.setControlRate(rate);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        juce::AudioBuffer<float> output(numChannels, numBlocks * blockSize);
+        juce::AudioBuffer<float> buffer(numChannels, blockSize);
+        juce::MidiBuffer midiBuffer;
+        PerformanceTimer timer;
+        elapsedMs = 0.0;
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            // Keep dirt, tone and wow moving so the smoothers never settle
+            const auto phase = static_cast<float>(block) * 0.05f;
+            setParameterValue(processor, TylerAudio::ParameterIDs::kDirt, 50.0f + 40.0f * std::sin(phase));
+            setParameterValue(processor, TylerAudio::ParameterIDs::kTone, 80.0f * std::sin(phase * 1.3f));
+            setParameterValue(processor, TylerAudio::ParameterIDs::kWow, 30.0f + 20.0f * std::sin(phase * 0.7f));
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                buffer.copyFrom(ch, 0, source, ch, (block % 15) * blockSize, blockSize);
+
+            timer.start();
+            processor.processBlock(buffer, midiBuffer);
+            elapsedMs += timer.getElapsedMilliseconds();
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                output.copyFrom(ch, block * blockSize, buffer, ch, 0, blockSize);
+        }
+
+        return output;
+    };
+
+    double perSampleMs = 0.0;
+    const auto reference = render(ControlRate::perSample, perSampleMs);
+    const auto referenceLevel = getRMSLevel(reference);
+
+    WARN("Per-sample control: " << (perSampleMs / audioDurationMs * 100.0) << "% CPU");
+
+    for (const auto rate : {ControlRate::every16Samples, ControlRate::every32Samples})
+    {
+        double elapsedMs = 0.0;
+        const auto output = render(rate, elapsedMs);
+
+        // Deviation from per-sample smoothing, relative to the output level
+        double errorEnergy = 0.0;
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < output.getNumSamples(); ++i)
+            {
+                const double difference = output.getSample(ch, i) - reference.getSample(ch, i);
+                errorEnergy += difference * difference;
+            }
+
+        const double errorRms = std::sqrt(errorEnergy / (numChannels * output.getNumSamples()));
+        const double errorDb = 20.0 * std::log10(juce::jmax(1.0e-12, errorRms / static_cast<double>(referenceLevel)));
+
+        WARN("Control every " << static_cast<int>(rate) << " samples: "
+             << (elapsedMs / audioDurationMs * 100.0) << "% CPU, "
+             << "speedup " << (perSampleMs / elapsedMs) << "x, "
+             << "deviation from per-sample " << errorDb << " dB");
+
+        INFO("Control interval: " << static_cast<int>(rate));
+        REQUIRE_FALSE(hasInvalidValues(output));
+        CHECK(errorDb < -30.0);  // Ramps must track the per-sample curve closely
+    }
+}
+
+TEST_CASE("TingeTape tone automation benchmark", "[TingeTape][performance][benchmark]")
+{
+    using TylerAudio::TingeTape::ToneControl;
+
+    // ToneControl with the tone held still against the tone swept end to end, per control
+    // interval. Automated blocks ramp the shelf coefficients, which should cost little more
+    // than filtering with fixed ones.
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 256;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const auto noise = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+
+    const std::vector<float> heldTone(static_cast<size_t>(totalSamples), 40.0f);
+    std::vector<float> sweptTone(static_cast<size_t>(totalSamples));
+
+    for (int i = 0; i < totalSamples; ++i)
+        sweptTone[static_cast<size_t>(i)] = 100.0f * std::sin(static_cast<float>(i) * 2.0e-4f);
+
+    for (const int controlInterval : {1, 16, 32})
+    {
+        auto measure = [&](const std::vector<float>& tone)
+        {
+            ToneControl<float> toneControl;
+            toneControl.prepare(sampleRate, blockSize, numChannels);
+            toneControl.setControlInterval(controlInterval);
+            int position = 0;
+
+            auto processBlock = [&](juce::AudioBuffer<float>& buffer)
+            {
+                juce::dsp::AudioBlock<float> block(buffer);
+                toneControl.process(block, tone.data() + position);
+                position = (position + blockSize) % (totalSamples - blockSize);
+            };
+
+            measureProcessingTimeMs(processBlock, noise, blockSize, static_cast<int>(sampleRate));
+            return measureProcessingTimeMs(processBlock, noise, blockSize, totalSamples);
+        };
+
+        const double staticMs = measure(heldTone);
+        const double automatedMs = measure(sweptTone);
+
+        WARN("Control every " << controlInterval << " samples: held tone "
+             << (staticMs / audioDurationMs * 100.0) << "% CPU, swept tone "
+             << (automatedMs / audioDurationMs * 100.0) << "% CPU, "
+             << "ratio " << (automatedMs / staticMs) << "x");
+
+        INFO("Control interval: " << controlInterval);
+        REQUIRE(automatedMs > 0.0);
+        checkSpeedup(automatedMs, staticMs, 0.5);
+    }
+}
+
+TEST_CASE("TingeTape cut filter modulation benchmark", "[TingeTape][performance][benchmark]")
+{
+    using namespace TylerAudio::TingeTape;
+
+    // Both cut filters swept end to end at full resonance. The biquads are redesigned once
+    // per block, as the processor does, and once per control interval, the least a biquad
+    // needs to follow automation smoothly; the state-variable filters take a new cutoff
+    // and resonance every sample, which should cost little more than the per-block designs.
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 512;
+    const int controlInterval = 16;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const auto noise = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+
+    std::vector<float> lowCutFreq(static_cast<size_t>(totalSamples));
+    std::vector<float> highCutFreq(static_cast<size_t>(totalSamples));
+    std::vector<float> resonance(static_cast<size_t>(totalSamples));
+
+    for (int i = 0; i < totalSamples; ++i)
+    {
+        const auto sweep = 0.5f + 0.5f * std::sin(static_cast<float>(i) * 2.0e-4f);
+        lowCutFreq[static_cast<size_t>(i)] = 20.0f + 180.0f * sweep;
+        highCutFreq[static_cast<size_t>(i)] = 20000.0f - 15000.0f * sweep;
+        resonance[static_cast<size_t>(i)] = 0.1f + 1.9f * sweep;
+    }
+
+    // Times a filter pair fed the sweep from the start, one block at a time
+    auto measure = [&](auto&& processFilters)
+    {
+        int position = 0;
+
+        auto processBlock = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+            processFilters(block, static_cast<size_t>(position));
+            position = (position + blockSize) % (totalSamples - blockSize);
+        };
+
+        measureProcessingTimeMs(processBlock, noise, blockSize, static_cast<int>(sampleRate));
+        return measureProcessingTimeMs(processBlock, noise, blockSize, totalSamples);
+    };
+
+    ToneControl<float> biquads;
+    biquads.prepare(sampleRate, blockSize, numChannels, 2);
+
+    // Redesigns both biquads at the first sample of each run of the block
+    auto processBiquads = [&](juce::dsp::AudioBlock<float>& block, size_t position, int runLength)
+    {
+        for (size_t start = 0; start < block.getNumSamples(); start += static_cast<size_t>(runLength))
+        {
+            const auto index = position + start;
+            BiquadDesign::makeHighPass(biquads.getFixedCoefficients(0), sampleRate, lowCutFreq[index], resonance[index]);
+            BiquadDesign::makeLowPass(biquads.getFixedCoefficients(1), sampleRate, highCutFreq[index], resonance[index]);
+
+            auto run = block.getSubBlock(start, static_cast<size_t>(runLength));
+            biquads.processFixed(run, 0, 2);
+        }
+    };
+
+    const double perBlockMs = measure([&](juce::dsp::AudioBlock<float>& block, size_t position)
+    {
+        processBiquads(block, position, blockSize);
+    });
+
+    const double perIntervalMs = measure([&](juce::dsp::AudioBlock<float>& block, size_t position)
+    {
+        processBiquads(block, position, controlInterval);
+    });
+
+    SIMDStateVariableFilter<float> lowCut, highCut;
+    lowCut.prepare(sampleRate, blockSize, numChannels, SIMDStateVariableFilter<float>::Type::highPass);
+    highCut.prepare(sampleRate, blockSize, numChannels, SIMDStateVariableFilter<float>::Type::lowPass);
+
+    const double perSampleMs = measure([&](juce::dsp::AudioBlock<float>& block, size_t position)
+    {
+        lowCut.process(block, lowCutFreq.data() + position, resonance.data() + position);
+        highCut.process(block, highCutFreq.data() + position, resonance.data() + position);
+    });
+
+    WARN("Biquads redesigned per block " << (perBlockMs / audioDurationMs * 100.0) << "% CPU, every "
+         << controlInterval << " samples " << (perIntervalMs / audioDurationMs * 100.0) << "% CPU; "
+         << "state-variable per sample " << (perSampleMs / audioDurationMs * 100.0) << "% CPU, "
+         << "ratio to per block " << (perSampleMs / perBlockMs) << "x, to every " << controlInterval << " samples "
+         << (perSampleMs / perIntervalMs) << "x");
+
+    REQUIRE(perSampleMs > 0.0);
+    checkSpeedup(perSampleMs, perIntervalMs, 0.5);
+}
+
+TEST_CASE("TingeTape cut filter coefficient benchmark", "[TingeTape][performance][benchmark]")
+{
+    using namespace TylerAudio::TingeTape;
+
+    // Both cut filters redesigned across their ranges, as under automation: the exact
+    // designs against the shared tables. Then the cost of the tables themselves, built by
+    // the first instance at a sample rate and shared by the rest.
+    const double sampleRate = 88200.0;  // A rate no other test prepares, so the first lookup builds
+    const int numUpdates = 200000;
+
+    std::vector<double> lowCutFreq(static_cast<size_t>(numUpdates));
+    std::vector<double> highCutFreq(static_cast<size_t>(numUpdates));
+    std::vector<double> resonance(static_cast<size_t>(numUpdates));
+
+    for (int i = 0; i < numUpdates; ++i)
+    {
+        const auto sweep = 0.5 + 0.5 * std::sin(i * 1.0e-3);
+        lowCutFreq[static_cast<size_t>(i)] = 20.0 + 180.0 * sweep;
+        highCutFreq[static_cast<size_t>(i)] = 20000.0 - 15000.0 * sweep;
+        resonance[static_cast<size_t>(i)] = 0.1 + 1.9 * sweep;
+    }
+
+    juce::SharedResourcePointer<CutFilterTableCache> cache;
+    PerformanceTimer timer;
+
+    timer.start();
+    const auto tables = cache->getTables(sampleRate);
+    const double buildMs = timer.getElapsedMilliseconds();
+
+    timer.start();
+    for (int instance = 0; instance < 64; ++instance)
+        REQUIRE(cache->getTables(sampleRate) == tables);
+    const double sharedMs = timer.getElapsedMilliseconds() / 64.0;
+
+    std::array<float, 10> coefficients{};
+    float checksum = 0.0f;
+
+    timer.start();
+    for (size_t i = 0; i < static_cast<size_t>(numUpdates); ++i)
+    {
+        BiquadDesign::makeHighPass(coefficients.data(), sampleRate, static_cast<float>(lowCutFreq[i]), static_cast<float>(resonance[i]));
+        BiquadDesign::makeLowPass(coefficients.data() + 5, sampleRate, static_cast<float>(highCutFreq[i]), static_cast<float>(resonance[i]));
+        checksum += coefficients[3] + coefficients[8];
+    }
+    const double designMs = timer.getElapsedMilliseconds();
+
+    timer.start();
+    for (size_t i = 0; i < static_cast<size_t>(numUpdates); ++i)
+    {
+        tables->lowCut.lookup(coefficients.data(), lowCutFreq[i], resonance[i]);
+        tables->highCut.lookup(coefficients.data() + 5, highCutFreq[i], resonance[i]);
+        checksum += coefficients[3] + coefficients[8];
+    }
+    const double lookupMs = timer.getElapsedMilliseconds();
+
+    WARN("Per update: exact designs " << (designMs * 1.0e6 / numUpdates) << " ns, table lookups "
+         << (lookupMs * 1.0e6 / numUpdates) << " ns, speedup " << (designMs / lookupMs) << "x; "
+         << "tables built in " << buildMs << " ms, shared in " << (sharedMs * 1000.0) << " us");
+
+    REQUIRE(std::isfinite(checksum));
+    REQUIRE(lookupMs > 0.0);
+    checkSpeedup(lookupMs, designMs);
+    checkSpeedup(sharedMs, buildMs);
+}
+
+TEST_CASE("TingeTape automation stress benchmark", "[TingeTape][performance][benchmark]")
+{
+    // Every smoothed parameter automated several times per block, against the same audio
+    // with the parameters held. Automation events only store the raw values, which the
+    // processor reads once per block, so dense automation costs the audio no more than
+    // the smoothing it asks for.
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 256;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const int numBlocks = totalSamples / blockSize;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const auto noise = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+
+    const char* const automatedParameterIDs[] = {
+        TylerAudio::ParameterIDs::kWow, TylerAudio::ParameterIDs::kFlutter, TylerAudio::ParameterIDs::kDrift,
+        TylerAudio::ParameterIDs::kLowCutFreq, TylerAudio::ParameterIDs::kLowCutRes,
+        TylerAudio::ParameterIDs::kHighCutFreq, TylerAudio::ParameterIDs::kHighCutRes,
+        TylerAudio::ParameterIDs::kDirt, TylerAudio::ParameterIDs::kTone
+    };
+
+    juce::MidiBuffer midiBuffer;
+
+    // Returns the processing time and the time spent issuing automation events separately
+    auto measure = [&](int eventsPerBlock)
+    {
+        TingeTapeAudioProcessor processor;
+        processor.prepareToPlay(sampleRate, blockSize);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kDirt, 50.0f);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kWow, 25.0f);
+
+        std::vector<juce::RangedAudioParameter*> automated;
+
+        for (const auto* parameterID : automatedParameterIDs)
+            automated.push_back(processor.getParameters().getParameter(parameterID));
+
+        REQUIRE(std::find(automated.begin(), automated.end(), nullptr) == automated.end());
+
+        // Each event moves the next parameter in turn somewhere across the middle of its range
+        int eventCount = 0;
+        std::chrono::steady_clock::duration eventTime{};
+
+        auto processBlock = [&](juce::AudioBuffer<float>& buffer)
+        {
+            const auto eventStart = std::chrono::steady_clock::now();
+
+            for (int event = 0; event < eventsPerBlock; ++event, ++eventCount)
+            {
+                const auto position = 0.5f + 0.3f * std::sin(static_cast<float>(eventCount) * 1.0e-3f);
+                automated[static_cast<size_t>(eventCount) % automated.size()]->setValueNotifyingHost(position);
+            }
+
+            eventTime += std::chrono::steady_clock::now() - eventStart;
+            processor.processBlock(buffer, midiBuffer);
+        };
+
+        measureProcessingTimeMs(processBlock, noise, blockSize, static_cast<int>(sampleRate));
+        eventCount = 0;
+        eventTime = {};
+
+        const double totalMs = measureProcessingTimeMs(processBlock, noise, blockSize, totalSamples);
+        const double eventMs = std::chrono::duration<double, std::milli>(eventTime).count();
+        REQUIRE(eventCount == eventsPerBlock * numBlocks);
+
+        return std::pair{totalMs - eventMs, eventMs};
+    };
+
+    const double heldMs = measure(0).first;
+
+    for (const int eventsPerBlock : {18, 72})
+    {
+        const auto [automatedMs, eventMs] = measure(eventsPerBlock);
+        const int numEvents = eventsPerBlock * numBlocks;
+
+        WARN(numEvents * 1000.0 / audioDurationMs << " automation events per second: held "
+             << (heldMs / audioDurationMs * 100.0) << "% CPU, automated "
+             << (automatedMs / audioDurationMs * 100.0) << "% CPU, ratio " << (automatedMs / heldMs)
+             << "x, " << (eventMs * 1.0e6 / numEvents) << " ns per event");
+
+        INFO("Events per block: " << eventsPerBlock);
+        REQUIRE(automatedMs > 0.0);
+        checkSpeedup(automatedMs, heldMs, 0.5);
+    }
+}
+
+TEST_CASE("TingeTape idle fast path benchmark", "[TingeTape][performance][benchmark]")
+{
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 256;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+
+    TingeTapeAudioProcessor processor;
+    processor.prepareToPlay(sampleRate, blockSize);
+    setParameterValue(processor, TylerAudio::ParameterIDs::kDirt, 50.0f);
+    setParameterValue(processor, TylerAudio::ParameterIDs::kTone, 30.0f);
+    setParameterValue(processor, TylerAudio::ParameterIDs::kWow, 25.0f);
+
+    juce::MidiBuffer midiBuffer;
+    auto processBlock = [&](juce::AudioBuffer<float>& buffer) { processor.processBlock(buffer, midiBuffer); };
+
+    const auto signal = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+    juce::AudioBuffer<float> silence(numChannels, static_cast<int>(sampleRate));
+    silence.clear();
+
+    const double activeMs = measureProcessingTimeMs(processBlock, signal, blockSize, totalSamples);
+
+    // Let the tail ring out, then measure a track sitting in silence
+    measureProcessingTimeMs(processBlock, silence, blockSize,
+                            static_cast<int>((processor.getTailLengthSeconds() + 0.1) * sampleRate));
+    const double idleMs = measureProcessingTimeMs(processBlock, silence, blockSize, totalSamples);
+
+    WARN("Active: " << (activeMs / audioDurationMs * 100.0) << "% CPU, "
+         << "idle: " << (idleMs / audioDurationMs * 100.0) << "% CPU, "
+         << "ratio " << (activeMs / idleMs) << "x");
+
+    REQUIRE(idleMs < activeMs);
+}
+
+TEST_CASE("TingeTape double precision benchmark", "[TingeTape][performance][benchmark]")
+{
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 256;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+
+    TingeTapeAudioProcessor floatProcessor;
+    TingeTapeAudioProcessor doubleProcessor;
+    REQUIRE(doubleProcessor.supportsDoublePrecisionProcessing());
+
+    for (auto* processor : {&floatProcessor, &doubleProcessor})
+    {
+        processor->prepareToPlay(sampleRate, blockSize);
+        setParameterValue(*processor, TylerAudio::ParameterIDs::kDirt, 50.0f);
+        setParameterValue(*processor, TylerAudio::ParameterIDs::kTone, 30.0f);
+        setParameterValue(*processor, TylerAudio::ParameterIDs::kWow, 25.0f);
+    }
+
+    juce::MidiBuffer midiBuffer;
+    const auto floatSignal = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+    juce::AudioBuffer<double> doubleSignal;
+    doubleSignal.makeCopyOf(floatSignal);
+
+    SECTION("Both precisions produce the same output")
+    {
+        juce::AudioBuffer<float> floatBuffer(numChannels, blockSize);
+        juce::AudioBuffer<double> doubleBuffer(numChannels, blockSize);
+        double maxDifference = 0.0;
+
+        for (int position = 0; position + blockSize <= floatSignal.getNumSamples(); position += blockSize)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                floatBuffer.copyFrom(ch, 0, floatSignal, ch, position, blockSize);
+                doubleBuffer.copyFrom(ch, 0, doubleSignal, ch, position, blockSize);
+            }
+
+            floatProcessor.processBlock(floatBuffer, midiBuffer);
+            doubleProcessor.processBlock(doubleBuffer, midiBuffer);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                for (int i = 0; i < blockSize; ++i)
+                    maxDifference = std::max(maxDifference,
+                                             std::abs(static_cast<double>(floatBuffer.getSample(ch, i))
+                                                      - doubleBuffer.getSample(ch, i)));
+        }
+
+        REQUIRE_FALSE(hasInvalidValues(floatBuffer));
+        REQUIRE(maxDifference < 1e-3);  // Only float rounding separates the two paths
+    }
+
+    SECTION("Float and double processing cost")
+    {
+        auto processFloat = [&](juce::AudioBuffer<float>& buffer) { floatProcessor.processBlock(buffer, midiBuffer); };
+        auto processDouble = [&](juce::AudioBuffer<double>& buffer) { doubleProcessor.processBlock(buffer, midiBuffer); };
+
+        // Warm up both paths before timing
+        measureProcessingTimeMs(processFloat, floatSignal, blockSize, static_cast<int>(sampleRate));
+        measureProcessingTimeMs(processDouble, doubleSignal, blockSize, static_cast<int>(sampleRate));
+
+        const double floatMs = measureProcessingTimeMs(processFloat, floatSignal, blockSize, totalSamples);
+        const double doubleMs = measureProcessingTimeMs(processDouble, doubleSignal, blockSize, totalSamples);
+
+        WARN("Float: " << (floatMs / audioDurationMs * 100.0) << "% CPU, "
+             << "double: " << (doubleMs / audioDurationMs * 100.0) << "% CPU, "
+             << "ratio " << (doubleMs / floatMs) << "x");
+
+        REQUIRE(doubleMs > 0.0);
+    }
+}
+
+TEST_CASE("TingeTape oversampling benchmark", "[TingeTape][performance][benchmark]")
+{
+    using TylerAudio::TingeTape::OversamplingFactor;
+    using TylerAudio::TingeTape::OversamplingFilter;
+
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 256;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const auto source = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+    juce::MidiBuffer midiBuffer;
+
+    for (const auto filter : {OversamplingFilter::polyphaseIIR, OversamplingFilter::linearPhaseFIR})
+    {
+        for (const auto factor : {OversamplingFactor::x1, OversamplingFactor::x2, OversamplingFactor::x4, OversamplingFactor::x8})
+        {
+            TingeTapeAudioProcessor processor;
+            processor.setOversamplingFactor(factor);
+            processor.setOversamplingFilter(filter);
+            processor.prepareToPlay(sampleRate, blockSize);
+            setParameterValue(processor, TylerAudio::ParameterIDs::kDirt, 50.0f);
+
+            auto processBlock = [&](juce::AudioBuffer<float>& buffer) { processor.processBlock(buffer, midiBuffer); };
+            measureProcessingTimeMs(processBlock, source, blockSize, static_cast<int>(sampleRate));
+            const double elapsedMs = measureProcessingTimeMs(processBlock, source, blockSize, totalSamples);
+
+            WARN((filter == OversamplingFilter::polyphaseIIR ? "IIR " : "FIR ")
+                 << (1 << static_cast<int>(factor)) << "x: "
+                 << (elapsedMs / audioDurationMs * 100.0) << "% CPU, "
+                 << processor.getLatencySamples() << " samples latency");
+
+            REQUIRE(elapsedMs < audioDurationMs);  // Every factor must still run in realtime
+        }
+    }
+}
+
+TEST_CASE("TingeTape modulated delay benchmark", "[TingeTape][performance][benchmark]")
+{
+    using TylerAudio::TingeTape::DelayInterpolation;
+
+    const int numChannels = 2;
+    const int blockSize = 512;
+
+    for (const double sampleRate : {44100.0, 48000.0, 96000.0, 192000.0})
+    {
+        const int totalSamples = static_cast<int>(sampleRate) * 5;
+        const int maxDelay = static_cast<int>(sampleRate * 0.05);
+        const auto source = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+
+        // A wow-like delay curve: 5 ms +/- 4 ms at 0.5 Hz, shared by both channels
+        std::vector<float> delayCurve(static_cast<size_t>(blockSize));
+        int position = 0;
+        auto renderCurve = [&]
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                const double phase = juce::MathConstants<double>::twoPi * 0.5 * (position + i) / sampleRate;
+                delayCurve[static_cast<size_t>(i)] = static_cast<float>(sampleRate * (0.005 + 0.004 * std::sin(phase)));
+            }
+            position += blockSize;
+        };
+
+        // Before: juce::dsp::DelayLine driven one sample at a time
+        juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> juceDelay(maxDelay + 1);
+        juceDelay.prepare({sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels)});
+
+        auto processJuce = [&](juce::AudioBuffer<float>& buffer)
+        {
+            renderCurve();
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto* data = buffer.getWritePointer(ch);
+
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    juceDelay.pushSample(ch, data[i]);
+                    data[i] = juceDelay.popSample(ch, delayCurve[static_cast<size_t>(i)]);
+                }
+            }
+        };
+
+        const double juceMs = measureProcessingTimeMs(processJuce, source, blockSize, totalSamples);
+
+        // After: the block-wise ring buffer with each interpolation
+        for (const auto interpolation : {DelayInterpolation::linear, DelayInterpolation::cubicHermite,
+                                         DelayInterpolation::lagrange3rd, DelayInterpolation::allpass})
+        {
+            TylerAudio::TingeTape::ModulatedDelay<float> delay;
+            delay.prepare(maxDelay, blockSize, numChannels);
+            delay.setInterpolation(interpolation);
+
+            auto processModulated = [&](juce::AudioBuffer<float>& buffer)
+            {
+                renderCurve();
+                juce::dsp::AudioBlock<float> block(buffer);
+                delay.process(block, delayCurve.data());
+            };
+
+            const double elapsedMs = measureProcessingTimeMs(processModulated, source, blockSize, totalSamples);
+
+            WARN(sampleRate << " Hz, interpolation " << static_cast<int>(interpolation) << ": "
+                 << "DelayLine " << juceMs << "ms, ring buffer " << elapsedMs << "ms, "
+                 << "speedup " << (juceMs / elapsedMs) << "x");
+
+            REQUIRE(elapsedMs > 0.0);
+            if (interpolation == DelayInterpolation::linear)
+                checkSpeedup(elapsedMs, juceMs);
+        }
+    }
+}
+
+TEST_CASE("TingeTape wow delay memory", "[TingeTape][performance][benchmark]")
+{
+    // Per-instance heap memory of the wow stage's delay. The figures it replaced are
+    // computed from their layouts: one juce::dsp::DelayLine per channel holding 50 ms plus
+    // its two guard samples, and planar rings that also had to hold a whole host block,
+    // with per-block read positions.
+    for (const double sampleRate : {44100.0, 48000.0, 96000.0, 192000.0})
+    {
+        const auto maxDelay = static_cast<size_t>(sampleRate * 0.05);
+
+        for (const int numChannels : {2, 16})
+        {
+            for (const int blockSize : {64, 512, 4096})
+            {
+                TylerAudio::TingeTape::WowEngine<float> wowEngine;
+                wowEngine.prepare(sampleRate, blockSize, numChannels);
+                const auto interleavedBytes = wowEngine.getMemoryUsageBytes();
+
+                const auto channels = static_cast<size_t>(numChannels);
+                const auto controlBytes = static_cast<size_t>(blockSize) * sizeof(float);
+                const auto perChannelDelayLineBytes = channels * (maxDelay + 2) * sizeof(float) + controlBytes;
+                const auto planarRingBytes = channels * sizeof(float)
+                    * static_cast<size_t>(juce::nextPowerOfTwo(static_cast<int>(maxDelay) + blockSize + 2))
+                    + static_cast<size_t>(blockSize) * (sizeof(int) + sizeof(float)) + controlBytes;
+
+                WARN(sampleRate << " Hz, " << numChannels << " channels, block " << blockSize << ": "
+                     << "DelayLine per channel " << perChannelDelayLineBytes / 1024 << " KiB, "
+                     << "planar rings " << planarRingBytes / 1024 << " KiB, "
+                     << "interleaved " << interleavedBytes / 1024 << " KiB");
+
+                // Large host blocks no longer enlarge the ring
+                if (blockSize == 4096)
+                    CHECK(interleavedBytes < planarRingBytes);
+            }
+        }
+    }
+}
+
+TEST_CASE("TingeTape transport modulation benchmark", "[TingeTape][performance][benchmark]")
+{
+    // Wow, flutter and drift together against the single per-sample wow LFO they replace,
+    // both producing the delay curve for the same block at the default control rate
+    const double sampleRate = 48000.0;
+    const int blockSize = 512;
+    const int numBlocks = static_cast<int>(sampleRate) * 60 / blockSize;  // One minute of audio
+    const double audioDurationMs = numBlocks * blockSize * 1000.0 / sampleRate;
+    const float samplesPerMs = static_cast<float>(sampleRate / 1000.0);
+    const float maxDelaySamples = (5.0f + TylerAudio::TingeTape::TransportModulation::kMaxOffsetMs) * samplesPerMs;
+
+    const std::vector<float> wow(static_cast<size_t>(blockSize), 25.0f);
+    const std::vector<float> flutter(static_cast<size_t>(blockSize), 40.0f);
+    const std::vector<float> drift(static_cast<size_t>(blockSize), 60.0f);
+    std::vector<float> delay(static_cast<size_t>(blockSize));
+
+    LegacyWowCurve legacy(sampleRate);
+
+    TylerAudio::TingeTape::TransportModulation bank;
+    bank.prepare(sampleRate);
+    bank.setControlInterval(static_cast<int>(TylerAudio::TingeTape::ControlRate::every16Samples));
+
+    auto renderLegacy = [&]
+    {
+        for (int block = 0; block < numBlocks; ++block)
+            legacy.render(delay.data(), wow.data(), blockSize);
+    };
+
+    auto renderBank = [&]
+    {
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            bank.render(delay.data(), wow.data(), flutter.data(), drift.data(), blockSize);
+
+            for (auto& d : delay)
+                d = juce::jlimit(1.0f, maxDelaySamples, (5.0f + d) * samplesPerMs);
+        }
+    };
+
+    auto time = [](auto& render)
+    {
+        PerformanceTimer timer;
+        timer.start();
+        render();
+        return timer.getElapsedMilliseconds();
+    };
+
+    // Warm up, then take the best of a few runs to keep scheduler noise out
+    renderLegacy();
+    renderBank();
+
+    double legacyMs = std::numeric_limits<double>::max();
+    double bankMs = std::numeric_limits<double>::max();
+
+    for (int run = 0; run < 5; ++run)
+    {
+        legacyMs = std::min(legacyMs, time(renderLegacy));
+        bankMs = std::min(bankMs, time(renderBank));
+    }
+
+    WARN("Single wow LFO: " << (legacyMs / audioDurationMs * 100.0) << "% CPU, "
+         << "wow + flutter + drift bank: " << (bankMs / audioDurationMs * 100.0) << "% CPU");
+
+    REQUIRE(bankMs > 0.0);
+    checkSpeedup(bankMs, legacyMs);
+}
+
+TEST_CASE("TingeTape saturation kernel benchmark", "[TingeTape][performance][benchmark]")
+{
+    using TylerAudio::TingeTape::SaturationKernel;
+
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 512;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const auto noise = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+    const auto sine = generateTestTone(1000.0f, 0.5f, sampleRate, static_cast<int>(sampleRate), numChannels);
+    const std::vector<float> drive(static_cast<size_t>(blockSize), 60.0f);
+
+    // THD of a driven 1 kHz sine over the odd harmonics that tanh produces, in percent.
+    // Goertzel over the settled second half, a whole number of cycles of every harmonic.
+    auto measureThd = [&](const juce::AudioBuffer<float>& output)
+    {
+        auto magnitudeAt = [&](double frequency)
+        {
+            return goertzelMagnitude(output, 0, output.getNumSamples() / 2, output.getNumSamples() / 4, frequency, sampleRate);
+        };
+
+        double harmonicPower = 0.0;
+        for (int harmonic = 3; harmonic <= 15; harmonic += 2)
+        {
+            const double magnitude = magnitudeAt(1000.0 * harmonic);
+            harmonicPower += magnitude * magnitude;
+        }
+
+        return 100.0 * std::sqrt(harmonicPower) / magnitudeAt(1000.0);
+    };
+
+    double referenceMs = 0.0;
+    double referenceThd = 0.0;
+
+    for (const auto kernel : {SaturationKernel::reference, SaturationKernel::fastMath,
+                              SaturationKernel::pade, SaturationKernel::clampedPolynomial})
+    {
+        TylerAudio::TingeTape::TapeSaturation<float> saturation;
+        saturation.prepare(sampleRate, blockSize, numChannels);
+        saturation.setControlInterval(static_cast<int>(TylerAudio::TingeTape::ControlRate::every16Samples));
+        saturation.setKernel(kernel);
+
+        auto processSaturation = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+            saturation.process(block, drive.data());
+        };
+
+        measureProcessingTimeMs(processSaturation, noise, blockSize, static_cast<int>(sampleRate));
+        const double elapsedMs = measureProcessingTimeMs(processSaturation, noise, blockSize, totalSamples);
+
+        double maxError = 0.0;
+        for (float x = -10.0f; x <= 10.0f; x += 0.001f)
+            maxError = std::max(maxError, std::abs(static_cast<double>(TylerAudio::TingeTape::SaturationKernels::evaluate(kernel, x))
+                                                   - std::tanh(static_cast<double>(x))));
+
+        saturation.reset();
+        juce::AudioBuffer<float> output;
+        output.makeCopyOf(sine);
+
+        for (int position = 0; position + blockSize <= output.getNumSamples(); position += blockSize)
+        {
+            juce::dsp::AudioBlock<float> block(output.getArrayOfWritePointers(), static_cast<size_t>(numChannels),
+                                               static_cast<size_t>(position), static_cast<size_t>(blockSize));
+            saturation.process(block, drive.data());
+        }
+
+        const double thd = measureThd(output);
+
+        if (kernel == SaturationKernel::reference)
+        {
+            referenceMs = elapsedMs;
+            referenceThd = thd;
+        }
+
+        WARN("Kernel " << static_cast<int>(kernel) << ": "
+             << (elapsedMs / audioDurationMs * 100.0) << "% CPU, "
+             << "speedup " << (referenceMs / elapsedMs) << "x, "
+             << "max error " << maxError << ", "
+             << "THD " << thd << "% (delta " << (thd - referenceThd) << ")");
+
+        REQUIRE(elapsedMs > 0.0);
+        REQUIRE(std::abs(thd - referenceThd) < 1.0);  // Every kernel keeps the character of the reference
+        if (kernel == SaturationKernel::fastMath)
+            checkSpeedup(elapsedMs, referenceMs);
+    }
+
+    SECTION("Shared transfer tables")
+    {
+        TylerAudio::TingeTape::TapeSaturation<float> saturation;
+        saturation.setTransferTablesEnabled(true);
+        saturation.prepare(sampleRate, blockSize, numChannels);
+        saturation.setControlInterval(static_cast<int>(TylerAudio::TingeTape::ControlRate::every16Samples));
+
+        auto processSaturation = [&](juce::AudioBuffer<float>& buffer)
+        {
+            juce::dsp::AudioBlock<float> block(buffer);
+            saturation.process(block, drive.data());
+        };
+
+        // Keep processing until the background thread has published the table
+        for (int attempt = 0; attempt < 2000 && saturation.getTransferTable() == nullptr; ++attempt)
+        {
+            measureProcessingTimeMs(processSaturation, noise, blockSize, blockSize);
+            juce::Thread::sleep(1);
+        }
+
+        REQUIRE(saturation.getTransferTable() != nullptr);
+
+        measureProcessingTimeMs(processSaturation, noise, blockSize, static_cast<int>(sampleRate));
+        const double elapsedMs = measureProcessingTimeMs(processSaturation, noise, blockSize, totalSamples);
+
+        WARN("Transfer table: " << (elapsedMs / audioDurationMs * 100.0) << "% CPU, "
+             << "speedup " << (referenceMs / elapsedMs) << "x over the libm kernel");
+
+        REQUIRE(elapsedMs > 0.0);
+        checkSpeedup(elapsedMs, referenceMs);
+    }
+}
+
+TEST_CASE("TingeTape anti-aliasing benchmark", "[TingeTape][performance][benchmark]")
+{
+    using TylerAudio::TingeTape::OversamplingFactor;
+    using TylerAudio::TingeTape::SaturationAntialiasing;
+
+    // Antiderivative anti-aliasing against oversampling: CPU of the whole plugin, latency,
+    // and the alias a driven 9 kHz sine leaves at 3 kHz (its folded 5th and 11th harmonics)
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 256;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const auto noise = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+    const auto sine = generateTestTone(9000.0f, 0.5f, sampleRate, static_cast<int>(sampleRate), numChannels);
+    juce::MidiBuffer midiBuffer;
+
+    struct Configuration
+    {
+        const char* name;
+        SaturationAntialiasing antialiasing;
+        OversamplingFactor oversampling;
+    };
+
+    const Configuration configurations[] = {{"Plain", SaturationAntialiasing::none, OversamplingFactor::x1},
+                                            {"ADAA 1st order", SaturationAntialiasing::firstOrder, OversamplingFactor::x1},
+                                            {"ADAA 2nd order", SaturationAntialiasing::secondOrder, OversamplingFactor::x1},
+                                            {"2x oversampling", SaturationAntialiasing::none, OversamplingFactor::x2},
+                                            {"4x oversampling", SaturationAntialiasing::none, OversamplingFactor::x4}};
+
+    double plainAliasDb = 0.0;
+    double firstOrderMs = 0.0;
+    double oversampled4xMs = 0.0;
+
+    for (const auto& configuration : configurations)
+    {
+        TingeTapeAudioProcessor processor;
+        processor.setSaturationAntialiasing(configuration.antialiasing);
+        processor.setOversamplingFactor(configuration.oversampling);
+        processor.prepareToPlay(sampleRate, blockSize);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kDirt, 60.0f);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kWow, 0.0f);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kTone, 0.0f);
+        setParameterValue(processor, TylerAudio::ParameterIDs::kHighCutFreq, 20000.0f);
+
+        auto processBlock = [&](juce::AudioBuffer<float>& buffer) { processor.processBlock(buffer, midiBuffer); };
+        measureProcessingTimeMs(processBlock, noise, blockSize, static_cast<int>(sampleRate));
+        const double elapsedMs = measureProcessingTimeMs(processBlock, noise, blockSize, totalSamples);
+
+        juce::AudioBuffer<float> output(numChannels, sine.getNumSamples());
+        juce::AudioBuffer<float> buffer(numChannels, blockSize);
+
+        for (int position = 0; position + blockSize <= output.getNumSamples(); position += blockSize)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                buffer.copyFrom(ch, 0, sine, ch, position, blockSize);
+
+            processor.processBlock(buffer, midiBuffer);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                output.copyFrom(ch, position, buffer, ch, 0, blockSize);
+        }
+
+        const int start = output.getNumSamples() / 2;
+        const int length = output.getNumSamples() / 10;
+        const double aliasDb = 20.0 * std::log10(goertzelMagnitude(output, 0, start, length, 3000.0, sampleRate)
+                                                 / goertzelMagnitude(output, 0, start, length, 9000.0, sampleRate));
+
+        if (configuration.antialiasing == SaturationAntialiasing::none && configuration.oversampling == OversamplingFactor::x1)
+            plainAliasDb = aliasDb;
+        else if (configuration.antialiasing == SaturationAntialiasing::firstOrder)
+            firstOrderMs = elapsedMs;
+        else if (configuration.oversampling == OversamplingFactor::x4)
+            oversampled4xMs = elapsedMs;
+
+        WARN(configuration.name << ": " << (elapsedMs / audioDurationMs * 100.0) << "% CPU, "
+             << processor.getLatencySamples() << " samples latency, alias " << aliasDb << " dB");
+
+        REQUIRE(elapsedMs < audioDurationMs);
+        REQUIRE(aliasDb <= plainAliasDb);
+
+        if (configuration.antialiasing != SaturationAntialiasing::none)
+            REQUIRE(processor.getLatencySamples() == 0);
+    }
+
+    WARN("First order ADAA costs " << (firstOrderMs / oversampled4xMs) << "x the CPU of 4x oversampling");
+
+    REQUIRE(firstOrderMs > 0.0);
+    checkSpeedup(firstOrderMs, oversampled4xMs);
+}
+
+TEST_CASE("TingeTape hysteresis solver benchmark", "[TingeTape][performance][benchmark]")
+{
+    using TylerAudio::TingeTape::HysteresisSolver;
+    using TylerAudio::TingeTape::OversamplingFactor;
+    using TylerAudio::TingeTape::SaturationModel;
+
+    // CPU of the whole plugin per hysteresis solver, against the tanh curve at the same
+    // factor. The realtime default has to leave headroom for a session at 2x; the offline
+    // one only has to run faster than realtime. White noise drives every solver up to its
+    // step budget, which counts oversampled samples, so 4x and 8x measure the worst case
+    // cost of a host block.
+    const double sampleRate = 48000.0;
+    const int numChannels = 2;
+    const int blockSize = 256;
+    const int totalSamples = static_cast<int>(sampleRate) * 5;
+    const double audioDurationMs = totalSamples * 1000.0 / sampleRate;
+    const auto noise = generateWhiteNoise(0.5f, static_cast<int>(sampleRate), numChannels);
+    juce::MidiBuffer midiBuffer;
+
+    for (const auto factor : {OversamplingFactor::x2, OversamplingFactor::x4, OversamplingFactor::x8})
+    {
+        auto measure = [&](SaturationModel model, HysteresisSolver solver)
+        {
+            TingeTapeAudioProcessor processor;
+            processor.setSaturationModel(model);
+            processor.setHysteresisSolver(solver);
+            processor.setOversamplingFactor(factor);
+            processor.prepareToPlay(sampleRate, blockSize);
+            setParameterValue(processor, TylerAudio::ParameterIDs::kDirt, 60.0f);
+
+            auto processBlock = [&](juce::AudioBuffer<float>& buffer) { processor.processBlock(buffer, midiBuffer); };
+            measureProcessingTimeMs(processBlock, noise, blockSize, static_cast<int>(sampleRate));
+            return measureProcessingTimeMs(processBlock, noise, blockSize, totalSamples);
+        };
+
+        const double tanhMs = measure(SaturationModel::tanh, HysteresisSolver::rk2);
+        const double rk2Ms = measure(SaturationModel::hysteresis, HysteresisSolver::rk2);
+        const double rk4Ms = measure(SaturationModel::hysteresis, HysteresisSolver::rk4);
+        const double newtonMs = measure(SaturationModel::hysteresis, HysteresisSolver::newtonRaphson);
+        const int oversampling = 1 << static_cast<int>(factor);
+
+        WARN(oversampling << "x, tanh: " << (tanhMs / audioDurationMs * 100.0) << "% CPU");
+        WARN(oversampling << "x, hysteresis, RK2: " << (rk2Ms / audioDurationMs * 100.0) << "% CPU");
+        WARN(oversampling << "x, hysteresis, RK4: " << (rk4Ms / audioDurationMs * 100.0) << "% CPU");
+        WARN(oversampling << "x, hysteresis, Newton-Raphson: " << (newtonMs / audioDurationMs * 100.0) << "% CPU");
+
+        INFO("Oversampling: " << oversampling << "x");
+        REQUIRE(rk2Ms > 0.0);
+        REQUIRE(rk2Ms < audioDurationMs);  // Every solver must still run in realtime at every factor
+        REQUIRE(rk4Ms < audioDurationMs);
+        REQUIRE(newtonMs < audioDurationMs);
+        checkSpeedup(rk2Ms, rk4Ms);
+
+        if (factor == OversamplingFactor::x2)
+            checkSpeedup(rk2Ms, audioDurationMs * 0.1);
+    }
+}
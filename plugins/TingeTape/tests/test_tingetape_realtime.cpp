@@ -0,0 +1,435 @@
+#include <catch2/catch_test_macros.hpp>
+#include <JuceHeader.h>
+#include "audio_test_utils.h"
+#include "../Source/PluginProcessor.h"
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
+
+using namespace TylerAudio::Testing;
+
+// =============================================================================
+// Global allocation tracking
+// =============================================================================
+// The replacement operator new/delete below count every heap allocation made through new,
+// in all its plain, array, aligned and nothrow forms (which covers std::vector,
+// std::function and reference-counted JUCE objects), while a ScopedAllocationCounter is
+// alive on the same thread, so background work such as the saturation table builder is
+// not counted. With glibc, malloc, calloc, realloc and the aligned C allocators are
+// replaced too, which covers juce::HeapBlock and so AudioBuffer::setSize(). Other C
+// libraries give no portable way to interpose them, so there only new is counted.
+
+#if defined(__GLIBC__)
+ #define TINGETAPE_COUNTS_MALLOC 1
+
+// glibc's own allocator entry points, which the replacements below forward to
+extern "C"
+{
+    void* __libc_malloc(std::size_t size);
+    void* __libc_calloc(std::size_t count, std::size_t size);
+    void* __libc_realloc(void* ptr, std::size_t size);
+    void* __libc_memalign(std::size_t alignment, std::size_t size);
+    void __libc_free(void* ptr);
+}
+#else
+ #define TINGETAPE_COUNTS_MALLOC 0
+#endif
+
+namespace
+{
+    thread_local bool isCountingAllocations{false};
+    std::atomic<int> numCountedAllocations{0};
+
+    class ScopedAllocationCounter
+    {
+    public:
+        ScopedAllocationCounter() noexcept
+        {
+            numCountedAllocations.store(0);
+            isCountingAllocations = true;
+        }
+
+        ~ScopedAllocationCounter() noexcept
+        {
+            isCountingAllocations = false;
+        }
+
+        [[nodiscard]] int getNumAllocations() const noexcept
+        {
+            return numCountedAllocations.load();
+        }
+    };
+
+    void countAllocation() noexcept
+    {
+        if (isCountingAllocations)
+            numCountedAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // The C library's allocator, bypassing the counting replacements of malloc
+    void* rawAllocate(std::size_t size) noexcept
+    {
+#if TINGETAPE_COUNTS_MALLOC
+        return __libc_malloc(size);
+#else
+        return std::malloc(size);
+#endif
+    }
+
+    void rawFree(void* ptr) noexcept
+    {
+#if TINGETAPE_COUNTS_MALLOC
+        __libc_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    void* allocateNoThrow(std::size_t size) noexcept
+    {
+        countAllocation();
+        return rawAllocate(size == 0 ? 1 : size);
+    }
+
+    void* allocate(std::size_t size)
+    {
+        if (auto* ptr = allocateNoThrow(size))
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+
+    // Over-aligned blocks are carved out of a larger plain one, with the plain block's
+    // address stored just before the aligned one so it can be freed
+    void* allocateAlignedNoThrow(std::size_t size, std::align_val_t alignment) noexcept
+    {
+        const auto align = juce::jmax(static_cast<std::size_t>(alignment), sizeof(void*));
+        countAllocation();
+
+        auto* block = static_cast<char*>(rawAllocate(size + align + sizeof(void*)));
+
+        if (block == nullptr)
+            return nullptr;
+
+        const auto address = reinterpret_cast<std::uintptr_t>(block + sizeof(void*));
+        auto* aligned = block + sizeof(void*) + (align - address % align) % align;
+        reinterpret_cast<void**>(aligned)[-1] = block;
+        return aligned;
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t alignment)
+    {
+        if (auto* ptr = allocateAlignedNoThrow(size, alignment))
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+
+    void freeAligned(void* ptr) noexcept
+    {
+        if (ptr != nullptr)
+            rawFree(static_cast<void**>(ptr)[-1]);
+    }
+}
+
+#if TINGETAPE_COUNTS_MALLOC
+extern "C"
+{
+    void* malloc(std::size_t size) noexcept
+    {
+        countAllocation();
+        return __libc_malloc(size);
+    }
+
+    void* calloc(std::size_t count, std::size_t size) noexcept
+    {
+        countAllocation();
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, std::size_t size) noexcept
+    {
+        countAllocation();
+        return __libc_realloc(ptr, size);
+    }
+
+    void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+    {
+        countAllocation();
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) noexcept
+    {
+        countAllocation();
+        *ptr = __libc_memalign(alignment, size);
+        return *ptr != nullptr || size == 0 ? 0 : ENOMEM;
+    }
+}
+#endif
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocateNoThrow(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocateNoThrow(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocateAlignedNoThrow(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocateAlignedNoThrow(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    rawFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    rawFree(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    rawFree(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    rawFree(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    rawFree(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    rawFree(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    freeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    freeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    freeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    freeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    freeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    freeAligned(ptr);
+}
+
+// =============================================================================
+// Realtime safety tests
+// =============================================================================
+
+TEST_CASE("TingeTape realtime safety", "[TingeTape][realtime]")
+{
+    SECTION("Allocation counter detects audio-thread allocations")
+    {
+        ScopedAllocationCounter counter;
+        auto coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(48000.0, 1000.0f);
+        juce::ignoreUnused(coefficients);
+
+        REQUIRE(counter.getNumAllocations() > 0);
+    }
+
+    SECTION("Allocation counter detects aligned and nothrow new")
+    {
+        struct alignas(64) OverAligned
+        {
+            float values[16];
+        };
+
+        ScopedAllocationCounter counter;
+        std::vector<OverAligned> aligned(4);
+        std::unique_ptr<int> nothrow(new (std::nothrow) int(1));
+
+        REQUIRE(reinterpret_cast<std::uintptr_t>(aligned.data()) % alignof(OverAligned) == 0);
+        REQUIRE(counter.getNumAllocations() == 2);
+    }
+
+#if TINGETAPE_COUNTS_MALLOC
+    SECTION("Allocation counter detects malloc, including AudioBuffer resizes")
+    {
+        juce::AudioBuffer<float> buffer(2, 64);
+        ScopedAllocationCounter counter;
+        buffer.setSize(2, 4096);
+
+        REQUIRE(counter.getNumAllocations() > 0);
+    }
+#endif
+
+    SECTION("processBlock performs zero heap allocations under continuous automation")
+    {
+        using namespace TylerAudio::TingeTape;
+
+        const double sampleRate = 48000.0;
+        const int blockSize = 64;
+        const int numBlocks = 2000;
+
+        // Each processing mode runs the same automation; the last also switches between the
+        // modes mid-stream, which every one of them promises to do without allocating
+        struct Configuration
+        {
+            const char* name;
+            std::function<void(TingeTapeAudioProcessor&)> beforePrepare;
+            std::function<void(TingeTapeAudioProcessor&, int)> perBlock;
+        };
+
+        const std::vector<Configuration> configurations = {
+            { "Biquad cut filters", [](auto&) {}, [](auto&, int) {} },
+            { "State-variable cut filters",
+              [](auto& processor) { processor.setCutFilterTopology(CutFilterTopology::stateVariable); },
+              [](auto&, int) {} },
+            { "4x oversampling",
+              [](auto& processor) { processor.setOversamplingFactor(OversamplingFactor::x4); },
+              [](auto&, int) {} },
+            { "Hysteresis saturation",
+              [](auto& processor)
+              {
+                  processor.setSaturationModel(SaturationModel::hysteresis);
+                  processor.setHysteresisSolver(HysteresisSolver::newtonRaphson);
+              },
+              [](auto&, int) {} },
+            { "Saturation tables",
+              [](auto& processor) { processor.setSaturationTablesEnabled(true); },
+              [](auto&, int) {} },
+            { "Switching modes",
+              [](auto&) {},
+              [](auto& processor, int block)
+              {
+                  const int phase = block / 100;
+                  processor.setCutFilterTopology(phase % 2 == 0 ? CutFilterTopology::biquad : CutFilterTopology::stateVariable);
+                  processor.setOversamplingFactor(static_cast<OversamplingFactor>(phase % 4));
+                  processor.setSaturationModel(phase % 3 == 2 ? SaturationModel::hysteresis : SaturationModel::tanh);
+                  processor.setHysteresisSolver(static_cast<HysteresisSolver>(phase % 3));
+              } },
+        };
+
+        for (const auto& configuration : configurations)
+        {
+            INFO("Configuration: " << configuration.name);
+
+            TingeTapeAudioProcessor processor;
+            configuration.beforePrepare(processor);
+            processor.prepareToPlay(sampleRate, blockSize);
+
+            auto& parameters = processor.getParameters();
+            const std::vector<const char*> automatedParameterIDs = {
+                TylerAudio::ParameterIDs::kWow,
+                TylerAudio::ParameterIDs::kFlutter,
+                TylerAudio::ParameterIDs::kDrift,
+                TylerAudio::ParameterIDs::kLowCutFreq,
+                TylerAudio::ParameterIDs::kLowCutRes,
+                TylerAudio::ParameterIDs::kHighCutFreq,
+                TylerAudio::ParameterIDs::kHighCutRes,
+                TylerAudio::ParameterIDs::kLowCutSlope,
+                TylerAudio::ParameterIDs::kHighCutSlope,
+                TylerAudio::ParameterIDs::kDirt,
+                TylerAudio::ParameterIDs::kTone,
+            };
+
+            std::vector<juce::RangedAudioParameter*> automatedParameters;
+            for (const auto* parameterID : automatedParameterIDs)
+            {
+                auto* parameter = parameters.getParameter(parameterID);
+                REQUIRE(parameter != nullptr);
+                automatedParameters.push_back(parameter);
+            }
+
+            auto* bypass = parameters.getParameter(TylerAudio::ParameterIDs::kBypass);
+            REQUIRE(bypass != nullptr);
+
+            auto source = generateWhiteNoise(0.5f, blockSize, 2);
+            juce::AudioBuffer<float> buffer(2, blockSize);
+            juce::MidiBuffer midiBuffer;
+            int totalAllocations = 0;
+
+            for (int block = 0; block < numBlocks; ++block)
+            {
+                // Sweep every parameter through its whole range at a different rate; the
+                // slopes step through all their choices and back
+                for (size_t index = 0; index < automatedParameters.size(); ++index)
+                {
+                    const double phase = block * 0.01 * static_cast<double>(index + 1);
+                    automatedParameters[index]->setValueNotifyingHost(
+                        static_cast<float>(0.5 + 0.5 * std::sin(phase)));
+                }
+
+                // Toggle bypass occasionally so both paths are covered
+                bypass->setValueNotifyingHost((block / 250) % 4 == 3 ? 1.0f : 0.0f);
+                configuration.perBlock(processor, block);
+
+                for (int ch = 0; ch < 2; ++ch)
+                    buffer.copyFrom(ch, 0, source, ch, 0, blockSize);
+
+                {
+                    ScopedAllocationCounter counter;
+                    processor.processBlock(buffer, midiBuffer);
+                    totalAllocations += counter.getNumAllocations();
+                }
+
+                REQUIRE_FALSE(hasInvalidValues(buffer));
+            }
+
+            INFO("Heap allocations inside processBlock: " << totalAllocations);
+            REQUIRE(totalAllocations == 0);
+        }
+    }
+}
@@ -3,12 +3,35 @@
 #include <JuceHeader.h>
 #include "audio_test_utils.h"
 #include "../Source/PluginProcessor.h"
+#include <algorithm>
+#include <limits>
 #include <vector>
 #include <cmath>
 
 using namespace TylerAudio::Testing;
 using Catch::Approx;
 
+namespace
+{
+    // Goertzel magnitude of one frequency over part of a channel
+    double goertzelMagnitude(const juce::AudioBuffer<float>& buffer, int channel, int start, int length,
+                             double frequency, double sampleRate)
+    {
+        const double coefficient = 2.0 * std::cos(juce::MathConstants<double>::twoPi * frequency / sampleRate);
+        double s1 = 0.0;
+        double s2 = 0.0;
+
+        for (int i = 0; i < length; ++i)
+        {
+            const double s0 = static_cast<double>(buffer.getSample(channel, start + i)) + coefficient * s1 - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        return std::sqrt(s1 * s1 + s2 * s2 - coefficient * s1 * s2);
+    }
+}
+
 TEST_CASE("TapeSaturation Drive Scaling Tests", "[TingeTape][unit][saturation][detailed]")
 {
     SECTION("Drive parameter mapping test - 1x to 10x gain range")
@@ -331,4 +354,597 @@ TEST_CASE("TapeSaturation Drive Scaling Tests", "[TingeTape][unit][saturation][d
             }
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("TapeSaturation oversampling", "[TingeTape][unit][saturation][detailed]")
+{
+    using TylerAudio::TingeTape::OversamplingFactor;
+    using TylerAudio::TingeTape::OversamplingFilter;
+
+    const double sampleRate = 48000.0;
+    const int blockSize = 480;
+
+    auto setParameter = [](TingeTapeAudioProcessor& processor, const char* parameterID, float value)
+    {
+        if (auto* parameter = processor.getParameters().getParameter(parameterID))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    };
+
+    SECTION("Latency is reported for the factor in use")
+    {
+        TingeTapeAudioProcessor processor;
+        processor.prepareToPlay(sampleRate, blockSize);
+        REQUIRE(processor.getLatencySamples() == 0);
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midiBuffer;
+        buffer.clear();
+
+        processor.setOversamplingFactor(OversamplingFactor::x4);
+        processor.processBlock(buffer, midiBuffer);
+        const int iirLatency = processor.getLatencySamples();
+        REQUIRE(iirLatency > 0);
+
+        processor.setOversamplingFilter(OversamplingFilter::linearPhaseFIR);
+        processor.processBlock(buffer, midiBuffer);
+        REQUIRE(processor.getLatencySamples() > iirLatency);
+
+        // Offline rendering switches to its own factor
+        processor.setOversamplingFactor(OversamplingFactor::x1, true);
+        processor.setNonRealtime(true);
+        processor.processBlock(buffer, midiBuffer);
+        REQUIRE(processor.getLatencySamples() == 0);
+
+        processor.setNonRealtime(false);
+        processor.processBlock(buffer, midiBuffer);
+        REQUIRE(processor.getLatencySamples() > iirLatency);
+    }
+
+    SECTION("Oversampling settings are saved with the state")
+    {
+        TingeTapeAudioProcessor processor;
+        processor.setOversamplingFactor(OversamplingFactor::x2);
+        processor.setOversamplingFactor(OversamplingFactor::x8, true);
+        processor.setOversamplingFilter(OversamplingFilter::linearPhaseFIR);
+
+        juce::MemoryBlock state;
+        processor.getStateInformation(state);
+
+        TingeTapeAudioProcessor restored;
+        restored.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+
+        REQUIRE(restored.getOversamplingFactor() == OversamplingFactor::x2);
+        REQUIRE(restored.getOversamplingFactor(true) == OversamplingFactor::x8);
+        REQUIRE(restored.getOversamplingFilter() == OversamplingFilter::linearPhaseFIR);
+    }
+
+    SECTION("Oversampling suppresses aliased harmonics")
+    {
+        // A driven 9 kHz sine grows odd harmonics. Without oversampling the 5th (45 kHz)
+        // and 11th (99 kHz) fold back onto 3 kHz; at 4x the first to land there is the
+        // 21st, which tanh barely produces at this drive.
+        const float fundamental = 9000.0f;
+        const float aliasFrequency = 3000.0f;
+        const int numSamples = static_cast<int>(sampleRate);
+
+        auto measureAliasDb = [&](OversamplingFactor factor)
+        {
+            TingeTapeAudioProcessor processor;
+            processor.setOversamplingFactor(factor);
+            processor.prepareToPlay(sampleRate, blockSize);
+            setParameter(processor, TylerAudio::ParameterIDs::kDirt, 60.0f);
+            setParameter(processor, TylerAudio::ParameterIDs::kWow, 0.0f);
+            setParameter(processor, TylerAudio::ParameterIDs::kTone, 0.0f);
+            setParameter(processor, TylerAudio::ParameterIDs::kHighCutFreq, 20000.0f);
+
+            const auto sine = generateTestTone(fundamental, 0.5f, sampleRate, numSamples, 2);
+            juce::AudioBuffer<float> output(2, numSamples);
+            juce::AudioBuffer<float> buffer(2, blockSize);
+            juce::MidiBuffer midiBuffer;
+
+            for (int position = 0; position + blockSize <= numSamples; position += blockSize)
+            {
+                for (int ch = 0; ch < 2; ++ch)
+                    buffer.copyFrom(ch, 0, sine, ch, position, blockSize);
+
+                processor.processBlock(buffer, midiBuffer);
+                output.copyFrom(0, position, buffer, 0, 0, blockSize);
+            }
+
+            // Goertzel magnitude over the settled second half, a whole number of cycles of both tones
+            auto magnitudeAt = [&](float frequency)
+            {
+                return goertzelMagnitude(output, 0, numSamples / 2, numSamples / 10, static_cast<double>(frequency), sampleRate);
+            };
+
+            REQUIRE_FALSE(hasInvalidValues(output));
+            return 20.0 * std::log10(magnitudeAt(aliasFrequency) / magnitudeAt(fundamental));
+        };
+
+        const double aliasDb1x = measureAliasDb(OversamplingFactor::x1);
+        const double aliasDb4x = measureAliasDb(OversamplingFactor::x4);
+
+        INFO("Alias at 3 kHz relative to the fundamental: 1x " << aliasDb1x << " dB, 4x " << aliasDb4x << " dB");
+        REQUIRE(aliasDb4x < aliasDb1x - 20.0);
+    }
+}
+
+TEST_CASE("TapeSaturation kernels", "[TingeTape][unit][saturation][detailed]")
+{
+    using TylerAudio::TingeTape::SaturationKernel;
+    namespace Kernels = TylerAudio::TingeTape::SaturationKernels;
+
+    struct KernelBound
+    {
+        SaturationKernel kernel;
+        double maxError;
+    };
+
+    const KernelBound bounds[] = {{SaturationKernel::reference, 1.0e-6},
+                                  {SaturationKernel::fastMath, 1.0e-4},
+                                  {SaturationKernel::pade, 1.5e-3},
+                                  {SaturationKernel::clampedPolynomial, 1.5e-2}};
+
+    // The drive gain reaches 10x, so a full-scale input sweeps the kernel over [-10, 10]
+    const int numPoints = 20001;
+    const float range = 10.0f;
+
+    for (const auto& bound : bounds)
+    {
+        INFO("Kernel " << static_cast<int>(bound.kernel));
+
+        double maxError = 0.0;
+        float previous = -2.0f;
+
+        for (int i = 0; i < numPoints; ++i)
+        {
+            const float x = -range + 2.0f * range * static_cast<float>(i) / static_cast<float>(numPoints - 1);
+            const float y = Kernels::evaluate(bound.kernel, x);
+
+            maxError = std::max(maxError, static_cast<double>(std::abs(y - std::tanh(x))));
+
+            REQUIRE(std::abs(y) <= 1.0f);
+            // Monotonic, so no drive setting folds the waveform back. Where a kernel flattens
+            // out, float rounding may dip by an ulp.
+            REQUIRE(y >= previous - std::numeric_limits<float>::epsilon());
+            REQUIRE(Kernels::evaluate(bound.kernel, -x) == -y);
+            previous = y;
+        }
+
+        REQUIRE(Kernels::evaluate(bound.kernel, 0.0f) == 0.0f);
+        REQUIRE(maxError < bound.maxError);
+    }
+
+    SECTION("Each kernel maps full scale to full scale")
+    {
+        // The normalisation uses the same kernel as the waveshaper, so full-scale input
+        // always maps to full scale whatever the accuracy
+        for (const auto& bound : bounds)
+        {
+            TylerAudio::TingeTape::TapeSaturation<float> saturation;
+            saturation.prepare(48000.0, 480, 1);
+            saturation.setKernel(bound.kernel);
+
+            // Full-scale DC at full drive: once the HF rolloff has settled only the 1 / 1.5
+            // level compensation remains
+            juce::AudioBuffer<float> buffer(1, 480);
+            const std::vector<float> drive(480, 100.0f);
+            juce::dsp::AudioBlock<float> block(buffer);
+
+            for (int pass = 0; pass < 4; ++pass)
+            {
+                juce::FloatVectorOperations::fill(buffer.getWritePointer(0), 1.0f, 480);
+                saturation.process(block, drive.data());
+            }
+
+            INFO("Kernel " << static_cast<int>(bound.kernel));
+            REQUIRE(buffer.getSample(0, 479) == Approx(1.0f / 1.5f).margin(1.0e-5f));
+        }
+    }
+}
+
+TEST_CASE("TapeSaturation transfer tables", "[TingeTape][unit][saturation][detailed]")
+{
+    using TylerAudio::TingeTape::SaturationTable;
+    using TylerAudio::TingeTape::TapeSaturation;
+
+    const int blockSize = 480;
+
+    // Process blocks of a 440 Hz sine until the table for the drive in use is taken up
+    auto settle = [&](TapeSaturation<float>& saturation, float drive)
+    {
+        const std::vector<float> driveControl(static_cast<size_t>(blockSize), drive);
+        juce::AudioBuffer<float> buffer(2, blockSize);
+
+        for (int attempt = 0; attempt < 2000; ++attempt)
+        {
+            buffer.makeCopyOf(generateTestTone(440.0f, 0.8f, 48000.0, blockSize, 2));
+            juce::dsp::AudioBlock<float> block(buffer);
+            saturation.process(block, driveControl.data());
+
+            const auto* table = saturation.getTransferTable();
+            if (table != nullptr && table->getDriveStep() == SaturationTable::toDriveStep(drive))
+                return true;
+
+            juce::Thread::sleep(1);
+        }
+
+        return false;
+    };
+
+    SECTION("Tables match the normalised tanh curve")
+    {
+        for (const int step : {0, 37, 100})
+        {
+            const SaturationTable table(step);
+            const double driveGain = 1.0 + 9.0 * step / 100.0;
+            double maxError = 0.0;
+
+            for (double x = -12.0; x <= 12.0; x += 0.0007)
+                maxError = std::max(maxError, std::abs(table.lookup(x) - std::tanh(x * driveGain) / std::tanh(driveGain)));
+
+            INFO("Drive step " << step);
+            REQUIRE(maxError < 1.0e-4);
+        }
+    }
+
+    SECTION("Instances share tables and follow the drive")
+    {
+        TapeSaturation<float> first;
+        TapeSaturation<float> second;
+
+        for (auto* saturation : {&first, &second})
+        {
+            saturation->setTransferTablesEnabled(true);
+            saturation->prepare(48000.0, blockSize, 2);
+            REQUIRE(saturation->getTransferTable() == nullptr);  // The kernel covers the build
+        }
+
+        REQUIRE(settle(first, 60.0f));
+        REQUIRE(settle(second, 60.0f));
+        REQUIRE(first.getTransferTable() == second.getTransferTable());
+
+        REQUIRE(settle(first, 20.0f));
+        REQUIRE(first.getTransferTable() != second.getTransferTable());
+    }
+
+    SECTION("Table output matches the kernel")
+    {
+        TapeSaturation<float> tables;
+        TapeSaturation<float> kernel;
+        tables.setTransferTablesEnabled(true);
+        tables.setKernel(TylerAudio::TingeTape::SaturationKernel::reference);
+        kernel.setKernel(TylerAudio::TingeTape::SaturationKernel::reference);
+        tables.prepare(48000.0, blockSize, 2);
+        kernel.prepare(48000.0, blockSize, 2);
+
+        REQUIRE(settle(tables, 75.0f));
+        kernel.reset();
+        tables.reset();
+
+        // Once the crossfade is over both run the same curve through the same rolloff
+        const std::vector<float> driveControl(static_cast<size_t>(blockSize), 75.0f);
+        const auto sine = generateTestTone(440.0f, 0.8f, 48000.0, blockSize, 2);
+        juce::AudioBuffer<float> tableBuffer;
+        juce::AudioBuffer<float> kernelBuffer;
+
+        for (int pass = 0; pass < 4; ++pass)
+        {
+            tableBuffer.makeCopyOf(sine);
+            kernelBuffer.makeCopyOf(sine);
+            juce::dsp::AudioBlock<float> tableBlock(tableBuffer);
+            juce::dsp::AudioBlock<float> kernelBlock(kernelBuffer);
+            tables.process(tableBlock, driveControl.data());
+            kernel.process(kernelBlock, driveControl.data());
+        }
+
+        for (int i = 0; i < blockSize; ++i)
+            REQUIRE(tableBuffer.getSample(0, i) == Approx(kernelBuffer.getSample(0, i)).margin(1.0e-4f));
+    }
+}
+
+TEST_CASE("TapeSaturation antiderivative anti-aliasing", "[TingeTape][unit][saturation][detailed]")
+{
+    using TylerAudio::TingeTape::SaturationAntialiasing;
+
+    const double sampleRate = 48000.0;
+    const int blockSize = 480;
+    const int numSamples = static_cast<int>(sampleRate);
+
+    // Drive a sine through the saturation alone and return it
+    auto saturate = [&](SaturationAntialiasing mode, float frequency, float amplitude)
+    {
+        TylerAudio::TingeTape::TapeSaturation<float> saturation;
+        saturation.prepare(sampleRate, blockSize, 1);
+        saturation.setAntialiasing(mode);
+
+        auto output = generateTestTone(frequency, amplitude, sampleRate, numSamples, 1);
+        const std::vector<float> drive(static_cast<size_t>(blockSize), 60.0f);
+
+        for (int position = 0; position + blockSize <= numSamples; position += blockSize)
+        {
+            juce::dsp::AudioBlock<float> block(output.getArrayOfWritePointers(), 1, static_cast<size_t>(position),
+                                               static_cast<size_t>(blockSize));
+            saturation.process(block, drive.data());
+        }
+
+        return output;
+    };
+
+    SECTION("Aliasing falls with each order")
+    {
+        // As in the oversampling test, the 5th and 11th harmonics of 9 kHz fold onto 3 kHz
+        auto aliasDb = [&](SaturationAntialiasing mode)
+        {
+            const auto output = saturate(mode, 9000.0f, 0.5f);
+            REQUIRE_FALSE(hasInvalidValues(output));
+            return 20.0 * std::log10(goertzelMagnitude(output, 0, numSamples / 2, numSamples / 10, 3000.0, sampleRate)
+                                     / goertzelMagnitude(output, 0, numSamples / 2, numSamples / 10, 9000.0, sampleRate));
+        };
+
+        const double none = aliasDb(SaturationAntialiasing::none);
+        const double firstOrder = aliasDb(SaturationAntialiasing::firstOrder);
+        const double secondOrder = aliasDb(SaturationAntialiasing::secondOrder);
+
+        INFO("Alias at 3 kHz: none " << none << " dB, first order " << firstOrder << " dB, second order " << secondOrder << " dB");
+        REQUIRE(firstOrder < none - 15.0);
+        REQUIRE(secondOrder < firstOrder - 10.0);
+    }
+
+    SECTION("Low frequencies keep the static curve")
+    {
+        // Well below Nyquist the averaging only delays the curve by half a sample per order
+        for (const auto mode : {SaturationAntialiasing::firstOrder, SaturationAntialiasing::secondOrder})
+        {
+            const auto plain = saturate(SaturationAntialiasing::none, 100.0f, 0.7f);
+            const auto antialiased = saturate(mode, 100.0f, 0.7f);
+            const double thirdHarmonicPlain = goertzelMagnitude(plain, 0, numSamples / 2, numSamples / 10, 300.0, sampleRate);
+            const double thirdHarmonicAntialiased = goertzelMagnitude(antialiased, 0, numSamples / 2, numSamples / 10, 300.0, sampleRate);
+
+            INFO("Order " << static_cast<int>(mode));
+            REQUIRE(thirdHarmonicAntialiased == Approx(thirdHarmonicPlain).epsilon(0.01));
+        }
+    }
+
+    SECTION("No latency, and the mode is saved with the state")
+    {
+        TingeTapeAudioProcessor processor;
+        processor.setSaturationAntialiasing(SaturationAntialiasing::secondOrder);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midiBuffer;
+        buffer.clear();
+        processor.processBlock(buffer, midiBuffer);
+        REQUIRE(processor.getLatencySamples() == 0);
+
+        juce::MemoryBlock state;
+        processor.getStateInformation(state);
+
+        TingeTapeAudioProcessor restored;
+        restored.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+        REQUIRE(restored.getSaturationAntialiasing() == SaturationAntialiasing::secondOrder);
+    }
+}
+
+TEST_CASE("TapeSaturation channel isolation", "[TingeTape][unit][saturation][detailed]")
+{
+    const double sampleRate = 48000.0;
+    const int blockSize = 480;
+
+    SECTION("A signal on the left does not leak into the right")
+    {
+        TingeTapeAudioProcessor processor;
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        if (auto* dirt = processor.getParameters().getParameter(TylerAudio::ParameterIDs::kDirt))
+            dirt->setValueNotifyingHost(dirt->convertTo0to1(80.0f));
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midiBuffer;
+
+        for (int pass = 0; pass < 20; ++pass)
+        {
+            buffer.makeCopyOf(generateTestTone(440.0f, 0.8f, sampleRate, blockSize, 2));
+            buffer.clear(1, 0, blockSize);
+            processor.processBlock(buffer, midiBuffer);
+
+            REQUIRE(getRMSLevel(buffer, 0) > 0.01f);
+            REQUIRE(buffer.getMagnitude(1, 0, blockSize) == 0.0f);
+        }
+    }
+
+    SECTION("Every channel keeps its own rolloff state")
+    {
+        // Enough channels to span more than one group of SIMD lanes
+        const int numChannels = 9;
+
+        for (int drivenChannel = 0; drivenChannel < numChannels; ++drivenChannel)
+        {
+            TylerAudio::TingeTape::TapeSaturation<float> saturation;
+            saturation.prepare(sampleRate, blockSize, numChannels);
+
+            juce::AudioBuffer<float> buffer(numChannels, blockSize);
+            const std::vector<float> drive(static_cast<size_t>(blockSize), 80.0f);
+            const auto tone = generateTestTone(440.0f, 0.8f, sampleRate, blockSize, 1);
+
+            for (int pass = 0; pass < 4; ++pass)
+            {
+                buffer.clear();
+                buffer.copyFrom(drivenChannel, 0, tone, 0, 0, blockSize);
+
+                juce::dsp::AudioBlock<float> block(buffer);
+                saturation.process(block, drive.data());
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                {
+                    INFO("Driven channel " << drivenChannel << ", channel " << ch);
+
+                    if (ch == drivenChannel)
+                        REQUIRE(buffer.getMagnitude(ch, 0, blockSize) > 0.01f);
+                    else
+                        REQUIRE(buffer.getMagnitude(ch, 0, blockSize) == 0.0f);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("TapeSaturation hysteresis model", "[TingeTape][unit][saturation][detailed]")
+{
+    using TylerAudio::TingeTape::HysteresisSolver;
+    using TylerAudio::TingeTape::SaturationModel;
+    namespace JilesAtherton = TylerAudio::TingeTape::JilesAtherton;
+
+    // The model runs at the oversampled rate, so drive it at 2x 48 kHz directly
+    const double sampleRate = 96000.0;
+    const int blockSize = 480;
+    const int numSamples = static_cast<int>(sampleRate) / 2;
+
+    auto saturate = [&](HysteresisSolver solver, const juce::AudioBuffer<float>& input, float drive,
+                        int* largestSolverSteps = nullptr)
+    {
+        TylerAudio::TingeTape::TapeSaturation<float> saturation;
+        saturation.prepare(sampleRate, blockSize, input.getNumChannels());
+        saturation.setModel(SaturationModel::hysteresis);
+        saturation.setHysteresisSolver(solver);
+
+        auto output = input;
+        const std::vector<float> driveValues(static_cast<size_t>(blockSize), drive);
+
+        for (int position = 0; position + blockSize <= output.getNumSamples(); position += blockSize)
+        {
+            juce::dsp::AudioBlock<float> block(output.getArrayOfWritePointers(), static_cast<size_t>(output.getNumChannels()),
+                                               static_cast<size_t>(position), static_cast<size_t>(blockSize));
+            saturation.process(block, driveValues.data());
+
+            if (largestSolverSteps != nullptr)
+                *largestSolverSteps = std::max(*largestSolverSteps, saturation.getLastHysteresisSolverSteps());
+        }
+
+        return output;
+    };
+
+    SECTION("The magnetisation traces a symmetric loop")
+    {
+        // Sweep the field slowly between +-2 and back, integrating dM/dH directly
+        const double fieldStep = 1.0e-3;
+        double magnetisation = 0.0;
+        double field = 0.0;
+
+        auto sweepTo = [&](double target)
+        {
+            const double direction = target > field ? 1.0 : -1.0;
+
+            while (direction * (target - field) > 1.0e-9)
+            {
+                const double start = JilesAtherton::magnetisationRate<false>(magnetisation, field, direction).value;
+                magnetisation += fieldStep * JilesAtherton::magnetisationRate<false>(magnetisation + 0.5 * fieldStep * start,
+                                                                                     field + 0.5 * direction * fieldStep, direction).value;
+                field += direction * fieldStep;
+            }
+        };
+
+        sweepTo(2.0);
+        sweepTo(0.0);
+        const double fallingRemanence = magnetisation;
+        sweepTo(-2.0);
+        const double negativePeak = magnetisation;
+        sweepTo(0.0);
+        const double risingRemanence = magnetisation;
+        sweepTo(2.0);
+        const double positivePeak = magnetisation;
+
+        INFO("Remanence " << fallingRemanence << " / " << risingRemanence << ", peaks " << negativePeak << " / " << positivePeak);
+        REQUIRE(fallingRemanence > 0.05);
+        REQUIRE(risingRemanence == Approx(-fallingRemanence).margin(1.0e-3));
+        REQUIRE(positivePeak == Approx(-negativePeak).margin(1.0e-3));
+        REQUIRE(positivePeak < JilesAtherton::anhysteretic(2.0));
+    }
+
+    SECTION("Every solver stays bounded and the solvers agree")
+    {
+        const auto sine = generateTestTone(220.0f, 0.8f, sampleRate, numSamples, 2);
+        const auto reference = saturate(HysteresisSolver::rk4, sine, 60.0f);
+
+        for (const auto solver : {HysteresisSolver::rk2, HysteresisSolver::newtonRaphson})
+        {
+            const auto output = saturate(solver, sine, 60.0f);
+            float largestDifference = 0.0f;
+
+            for (int i = 0; i < numSamples; ++i)
+                largestDifference = std::max(largestDifference, std::abs(output.getSample(0, i) - reference.getSample(0, i)));
+
+            INFO("Solver " << static_cast<int>(solver) << ": largest difference from RK4 " << largestDifference);
+            REQUIRE_FALSE(hasInvalidValues(output));
+            REQUIRE(output.getMagnitude(0, numSamples) < 1.1f);
+            REQUIRE(largestDifference < 2.0e-3f);
+        }
+    }
+
+    SECTION("Steep edges stay within the solver step budget")
+    {
+        // A full drive square wave jumps the field by 18 in one sample
+        const int numChannels = 3;
+        juce::AudioBuffer<float> square(numChannels, numSamples);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < numSamples; ++i)
+                square.setSample(ch, i, (i / 109) % 2 == 0 ? 0.9f : -0.9f);
+
+        using Saturation = TylerAudio::TingeTape::TapeSaturation<float>;
+        const int numLaneGroups = TylerAudio::TingeTape::SIMDLaneScratch<float>::getNumLaneGroups(numChannels);
+
+        for (const auto solver : {HysteresisSolver::rk2, HysteresisSolver::rk4, HysteresisSolver::newtonRaphson})
+        {
+            int largestSolverSteps = 0;
+            const auto output = saturate(solver, square, 100.0f, &largestSolverSteps);
+
+            INFO("Solver " << static_cast<int>(solver) << ": " << largestSolverSteps << " steps in a block");
+            REQUIRE_FALSE(hasInvalidValues(output));
+            REQUIRE(output.getMagnitude(0, numSamples) < 2.5f);
+            REQUIRE(largestSolverSteps > blockSize * numLaneGroups);
+            REQUIRE(largestSolverSteps <= Saturation::kSolverStepBudget * blockSize * numLaneGroups);
+        }
+    }
+
+    SECTION("Remanence does not leave a DC offset")
+    {
+        auto burst = generateTestTone(220.0f, 0.8f, sampleRate, numSamples, 1);
+        burst.clear(0, numSamples / 10, numSamples - numSamples / 10);
+
+        for (const auto solver : {HysteresisSolver::rk2, HysteresisSolver::rk4, HysteresisSolver::newtonRaphson})
+        {
+            const auto output = saturate(solver, burst, 60.0f);
+
+            INFO("Solver " << static_cast<int>(solver));
+            REQUIRE(output.getMagnitude(0, numSamples - blockSize, blockSize) < 1.0e-4f);
+        }
+    }
+
+    SECTION("HQ mode oversamples, and its settings are saved with the state")
+    {
+        TingeTapeAudioProcessor processor;
+        processor.setSaturationModel(SaturationModel::hysteresis);
+        processor.setHysteresisSolver(HysteresisSolver::newtonRaphson, false);
+        processor.setHysteresisSolver(HysteresisSolver::rk2, true);
+        processor.prepareToPlay(48000.0, blockSize);
+        REQUIRE(processor.getLatencySamples() > 0);
+
+        juce::MemoryBlock state;
+        processor.getStateInformation(state);
+
+        TingeTapeAudioProcessor restored;
+        restored.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+        REQUIRE(restored.getSaturationModel() == SaturationModel::hysteresis);
+        REQUIRE(restored.getHysteresisSolver(false) == HysteresisSolver::newtonRaphson);
+        REQUIRE(restored.getHysteresisSolver(true) == HysteresisSolver::rk2);
+
+        // Back to the memoryless curve, nothing needs oversampling
+        processor.setSaturationModel(SaturationModel::tanh);
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midiBuffer;
+        buffer.clear();
+        processor.processBlock(buffer, midiBuffer);
+        REQUIRE(processor.getLatencySamples() == 0);
+    }
+}
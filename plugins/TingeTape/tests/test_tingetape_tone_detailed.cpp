@@ -3,6 +3,8 @@
 #include <JuceHeader.h>
 #include "audio_test_utils.h"
 #include "../Source/PluginProcessor.h"
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <cmath>
 
@@ -332,4 +334,117 @@ TEST_CASE("ToneControl Calibration Tests", "[TingeTape][unit][tone][detailed]")
             REQUIRE(gainDb <= testCase.expectedMaxGain);
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("ToneControl automation", "[TingeTape][unit][tone][detailed]")
+{
+    using TylerAudio::TingeTape::ToneControl;
+
+    const double sampleRate = 48000.0;
+    const int blockSize = 256;
+    const int numSamples = blockSize * 188; // about a second, in whole blocks
+
+    // Runs a ToneControl over the input with a per-sample tone, as the processor does
+    auto processTone = [&](juce::AudioBuffer<float>& buffer, const std::vector<float>& tone, int controlInterval)
+    {
+        ToneControl<float> toneControl;
+        toneControl.prepare(sampleRate, blockSize, buffer.getNumChannels());
+        toneControl.setControlInterval(controlInterval);
+
+        for (int position = 0; position + blockSize <= buffer.getNumSamples(); position += blockSize)
+        {
+            juce::dsp::AudioBlock<float> block(buffer.getArrayOfWritePointers(), static_cast<size_t>(buffer.getNumChannels()),
+                                               static_cast<size_t>(position), static_cast<size_t>(blockSize));
+            toneControl.process(block, tone.data() + position);
+        }
+    };
+
+    SECTION("Every channel keeps its own filter state")
+    {
+        const auto sine = generateTestTone(3000.0f, 0.5f, sampleRate, numSamples, 1);
+        const auto noise = generateWhiteNoise(0.5f, numSamples, 1);
+        const std::vector<float> tone(static_cast<size_t>(numSamples), 60.0f);
+
+        juce::AudioBuffer<float> mono(1, numSamples);
+        mono.copyFrom(0, 0, sine, 0, 0, numSamples);
+        processTone(mono, tone, 16);
+
+        juce::AudioBuffer<float> stereo(2, numSamples);
+        stereo.copyFrom(0, 0, sine, 0, 0, numSamples);
+        stereo.copyFrom(1, 0, noise, 0, 0, numSamples);
+        processTone(stereo, tone, 16);
+
+        for (int i = 0; i < numSamples; ++i)
+            REQUIRE(stereo.getSample(0, i) == mono.getSample(0, i));
+    }
+
+    SECTION("A sweep follows the exact design without stepping")
+    {
+        // Tone swept from -100 to +100 over about a second, against both shelves redesigned
+        // exactly at every sample in double precision
+        const auto input = generateWhiteNoise(0.5f, numSamples, 1);
+        std::vector<float> tone(static_cast<size_t>(numSamples));
+
+        for (int i = 0; i < numSamples; ++i)
+            tone[static_cast<size_t>(i)] = -100.0f + 200.0f * static_cast<float>(i) / static_cast<float>(numSamples - 1);
+
+        std::vector<double> reference(static_cast<size_t>(numSamples));
+        std::array<std::array<double, 2>, 2> state{};
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const double gainDb = static_cast<double>(tone[static_cast<size_t>(i)]) / 100.0 * 6.0;
+            std::array<std::array<double, 5>, 2> coefficients;
+            TylerAudio::TingeTape::BiquadDesign::makeLowShelf(coefficients[0].data(), sampleRate, 250.0, 0.707,
+                                                             juce::Decibels::decibelsToGain(-gainDb));
+            TylerAudio::TingeTape::BiquadDesign::makeHighShelf(coefficients[1].data(), sampleRate, 5000.0, 0.707,
+                                                              juce::Decibels::decibelsToGain(gainDb));
+
+            double x = static_cast<double>(input.getSample(0, i));
+
+            for (size_t section = 0; section < 2; ++section)
+            {
+                const auto& k = coefficients[section];
+                const double y = k[0] * x + state[section][0];
+                state[section][0] = k[1] * x - k[3] * y + state[section][1];
+                state[section][1] = k[2] * x - k[4] * y;
+                x = y;
+            }
+
+            reference[static_cast<size_t>(i)] = x;
+        }
+
+        for (const int controlInterval : {1, 16, 32})
+        {
+            juce::AudioBuffer<float> output;
+            output.makeCopyOf(input);
+            processTone(output, tone, controlInterval);
+
+            double largestError = 0.0;
+            for (int i = 0; i < numSamples; ++i)
+                largestError = std::max(largestError, std::abs(static_cast<double>(output.getSample(0, i)) - reference[static_cast<size_t>(i)]));
+
+            INFO("Control interval " << controlInterval << ": largest error " << largestError);
+            REQUIRE(largestError < 1.0e-3);
+        }
+    }
+
+    SECTION("Holding a setting between design points matches a fixed setting")
+    {
+        const auto input = generateWhiteNoise(0.5f, numSamples, 1);
+        std::vector<float> swept(static_cast<size_t>(numSamples), 37.0f);
+        const std::vector<float> fixed(static_cast<size_t>(numSamples), 37.0f);
+
+        for (int i = 0; i < numSamples / 4; ++i)
+            swept[static_cast<size_t>(i)] = -100.0f + 137.0f * static_cast<float>(i) / static_cast<float>(numSamples / 4);
+
+        juce::AudioBuffer<float> sweptOutput;
+        juce::AudioBuffer<float> fixedOutput;
+        sweptOutput.makeCopyOf(input);
+        fixedOutput.makeCopyOf(input);
+        processTone(sweptOutput, swept, 16);
+        processTone(fixedOutput, fixed, 16);
+
+        for (int i = numSamples / 2; i < numSamples; ++i)
+            REQUIRE(sweptOutput.getSample(0, i) == Approx(fixedOutput.getSample(0, i)).margin(1.0e-5f));
+    }
+}
@@ -3,6 +3,12 @@
 #include <JuceHeader.h>
 #include "audio_test_utils.h"
 #include "../Source/PluginProcessor.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
 
 using namespace TylerAudio::Testing;
 using Catch::Approx;
@@ -254,6 +260,421 @@ TEST_CASE("TingeTape Unit Tests - ResonantFilters", "[TingeTape][unit][filters]"
     }
 }
 
+TEST_CASE("TingeTape Unit Tests - State-variable cut filters", "[TingeTape][unit][filters]")
+{
+    using Filter = TylerAudio::TingeTape::SIMDStateVariableFilter<float>;
+    
+    const double sampleRate = 48000.0;
+    const int blockSize = 512;
+    const int numBlocks = 32;
+    const int numSamples = blockSize * numBlocks;
+    
+    // Runs a filter over the buffer with per-sample cutoff and resonance, block by block
+    auto processFilter = [&](juce::AudioBuffer<float>& buffer, Filter::Type type,
+                             const std::vector<float>& cutoff, const std::vector<float>& resonance)
+    {
+        Filter filter;
+        filter.prepare(sampleRate, blockSize, buffer.getNumChannels(), type);
+        
+        for (int position = 0; position < numSamples; position += blockSize)
+        {
+            juce::dsp::AudioBlock<float> block(buffer.getArrayOfWritePointers(), static_cast<size_t>(buffer.getNumChannels()),
+                                               static_cast<size_t>(position), static_cast<size_t>(blockSize));
+            filter.process(block, cutoff.data() + position, resonance.data() + position);
+        }
+    };
+    
+    SECTION("A fixed cutoff matches the biquad design")
+    {
+        const auto input = generateWhiteNoise(0.5f, numSamples, 2);
+        
+        struct Setting
+        {
+            Filter::Type type;
+            float cutoff;
+            float resonance;
+        };
+        
+        for (const auto& setting : {Setting{Filter::Type::highPass, 100.0f, 0.707f},
+                                    Setting{Filter::Type::highPass, 40.0f, 2.0f},
+                                    Setting{Filter::Type::lowPass, 15000.0f, 0.707f},
+                                    Setting{Filter::Type::lowPass, 8000.0f, 0.1f}})
+        {
+            std::array<double, 5> coefficients;
+            
+            if (setting.type == Filter::Type::highPass)
+                TylerAudio::TingeTape::BiquadDesign::makeHighPass(coefficients.data(), sampleRate,
+                                                                 static_cast<double>(setting.cutoff),
+                                                                 static_cast<double>(setting.resonance));
+            else
+                TylerAudio::TingeTape::BiquadDesign::makeLowPass(coefficients.data(), sampleRate,
+                                                                static_cast<double>(setting.cutoff),
+                                                                static_cast<double>(setting.resonance));
+            
+            juce::AudioBuffer<float> output;
+            output.makeCopyOf(input);
+            processFilter(output, setting.type, std::vector<float>(static_cast<size_t>(numSamples), setting.cutoff),
+                          std::vector<float>(static_cast<size_t>(numSamples), setting.resonance));
+            
+            for (int channel = 0; channel < 2; ++channel)
+            {
+                std::array<double, 2> state{};
+                double maxError = 0.0;
+                
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    const double x = static_cast<double>(input.getSample(channel, i));
+                    const double y = coefficients[0] * x + state[0];
+                    state[0] = coefficients[1] * x - coefficients[3] * y + state[1];
+                    state[1] = coefficients[2] * x - coefficients[4] * y;
+                    maxError = std::max(maxError, std::abs(y - static_cast<double>(output.getSample(channel, i))));
+                }
+                
+                INFO("Cutoff: " << setting.cutoff << "Hz, Q: " << setting.resonance << ", max error: " << maxError);
+                REQUIRE(maxError < 1.0e-3);
+            }
+        }
+    }
+    
+    SECTION("Per-sample resonant sweeps stay bounded")
+    {
+        // Cutoff jumping between the ends of each range every few milliseconds at the
+        // highest resonance, far harsher than any automation the smoothers pass on
+        const auto input = generateWhiteNoise(0.5f, numSamples, 2);
+        const std::vector<float> resonance(static_cast<size_t>(numSamples), 2.0f);
+        
+        for (const auto type : {Filter::Type::highPass, Filter::Type::lowPass})
+        {
+            const float low = type == Filter::Type::highPass ? 20.0f : 5000.0f;
+            const float high = type == Filter::Type::highPass ? 200.0f : 20000.0f;
+            std::vector<float> cutoff(static_cast<size_t>(numSamples));
+            
+            for (int i = 0; i < numSamples; ++i)
+                cutoff[static_cast<size_t>(i)] = (i / 200) % 2 == 0 ? low : high;
+            
+            juce::AudioBuffer<float> output;
+            output.makeCopyOf(input);
+            processFilter(output, type, cutoff, resonance);
+            
+            REQUIRE_FALSE(hasInvalidValues(output));
+            REQUIRE(output.getMagnitude(0, numSamples) < 8.0f);
+        }
+    }
+    
+    SECTION("The processor saves its topology and processes with it")
+    {
+        TingeTapeAudioProcessor processor;
+        processor.setCutFilterTopology(TylerAudio::TingeTape::CutFilterTopology::stateVariable);
+        processor.prepareToPlay(sampleRate, blockSize);
+        
+        auto buffer = generateWhiteNoise(0.5f, blockSize, 2);
+        juce::MidiBuffer midiBuffer;
+        processor.processBlock(buffer, midiBuffer);
+        REQUIRE_FALSE(hasInvalidValues(buffer));
+        
+        juce::MemoryBlock state;
+        processor.getStateInformation(state);
+        
+        TingeTapeAudioProcessor restored;
+        REQUIRE(restored.getCutFilterTopology() == TylerAudio::TingeTape::CutFilterTopology::biquad);
+        restored.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+        REQUIRE(restored.getCutFilterTopology() == TylerAudio::TingeTape::CutFilterTopology::stateVariable);
+    }
+}
+
+TEST_CASE("TingeTape Unit Tests - Cut filter tables", "[TingeTape][unit][filters]")
+{
+    using TylerAudio::TingeTape::CutFilterTable;
+    using TylerAudio::TingeTape::CutFilterTableCache;
+    using Coefficients = std::array<double, 5>;
+    
+    // Magnitude of a {b0, b1, b2, a1, a2} section's response in dB
+    auto magnitudeDb = [](const Coefficients& c, double sampleRate, double frequency)
+    {
+        const auto z = std::polar(1.0, -juce::MathConstants<double>::twoPi * frequency / sampleRate);
+        const auto response = (c[0] + c[1] * z + c[2] * z * z) / (1.0 + c[3] * z + c[4] * z * z);
+        return juce::Decibels::gainToDecibels(std::abs(response), -200.0);
+    };
+    
+    SECTION("Lookups match the exact designs")
+    {
+        for (const double sampleRate : {44100.0, 48000.0, 96000.0, 192000.0})
+        {
+            const CutFilterTable lowCut(sampleRate, CutFilterTable::Response::highPass, 20.0, 200.0);
+            const CutFilterTable highCut(sampleRate, CutFilterTable::Response::lowPass, 5000.0, 20000.0);
+            
+            // Points between the grid lines, where interpolation is least accurate
+            for (int step = 0; step < 50; ++step)
+            {
+                const double position = (step + 0.5) / 50.0;
+                const double q = 0.1 * std::pow(80.0, std::fmod(position * 7.3, 1.0));
+                const double lowCutFreq = 20.0 * std::pow(10.0, position);
+                const double highCutFreq = 5000.0 * std::pow(4.0, position);
+                
+                Coefficients looked, exact;
+                double maxErrorDb = 0.0;
+                
+                lowCut.lookup(looked.data(), lowCutFreq, q);
+                TylerAudio::TingeTape::BiquadDesign::makeHighPass(exact.data(), sampleRate, lowCutFreq, q);
+                
+                for (double frequency = 10.0; frequency < sampleRate * 0.49; frequency *= 1.05)
+                    if (magnitudeDb(exact, sampleRate, frequency) > -60.0)
+                        maxErrorDb = std::max(maxErrorDb, std::abs(magnitudeDb(looked, sampleRate, frequency)
+                                                                   - magnitudeDb(exact, sampleRate, frequency)));
+                
+                highCut.lookup(looked.data(), highCutFreq, q);
+                TylerAudio::TingeTape::BiquadDesign::makeLowPass(exact.data(), sampleRate, highCutFreq, q);
+                
+                for (double frequency = 10.0; frequency < sampleRate * 0.49; frequency *= 1.05)
+                    if (magnitudeDb(exact, sampleRate, frequency) > -60.0)
+                        maxErrorDb = std::max(maxErrorDb, std::abs(magnitudeDb(looked, sampleRate, frequency)
+                                                                   - magnitudeDb(exact, sampleRate, frequency)));
+                
+                INFO("Sample rate: " << sampleRate << ", low cut: " << lowCutFreq << "Hz, high cut: "
+                     << highCutFreq << "Hz, Q: " << q << ", error: " << maxErrorDb << "dB");
+                REQUIRE(maxErrorDb < 0.1);
+            }
+        }
+    }
+    
+    SECTION("Values outside the range land on its edges")
+    {
+        const CutFilterTable lowCut(48000.0, CutFilterTable::Response::highPass, 20.0, 200.0);
+        Coefficients below, further, above;
+        
+        lowCut.lookup(below.data(), 15.0, 0.05);
+        lowCut.lookup(further.data(), 1.0, 0.001);
+        REQUIRE(further == below);
+        
+        lowCut.lookup(above.data(), 300.0, 10.0);
+        lowCut.lookup(further.data(), 10000.0, 100.0);
+        REQUIRE(further == above);
+        REQUIRE(above != below);
+        
+        lowCut.lookup(further.data(), std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN());
+        REQUIRE(std::all_of(further.begin(), further.end(), [](double c) { return std::isfinite(c); }));
+    }
+    
+    SECTION("Instances at the same sample rate share tables")
+    {
+        juce::SharedResourcePointer<CutFilterTableCache> firstCache, secondCache;
+        
+        const auto first = firstCache->getTables(48000.0);
+        const auto second = secondCache->getTables(48000.0);
+        const auto other = secondCache->getTables(96000.0);
+        
+        REQUIRE(first.get() == second.get());
+        REQUIRE(other.get() != first.get());
+        REQUIRE(other->sampleRate == Approx(96000.0));
+    }
+}
+
+TEST_CASE("TingeTape Unit Tests - Cut filter slopes", "[TingeTape][unit][filters]")
+{
+    using TylerAudio::TingeTape::BiquadDesign::resonantSectionQ;
+    using Coefficients = std::array<double, 5>;
+    
+    const double sampleRate = 48000.0;
+    
+    // Response of numSections cascaded sections at one frequency, in dB
+    auto cascadeMagnitudeDb = [&](bool highPass, double cutoff, double resonance, int numSections, double frequency)
+    {
+        const auto z = std::polar(1.0, -juce::MathConstants<double>::twoPi * frequency / sampleRate);
+        double magnitude = 1.0;
+        
+        for (int section = 0; section < numSections; ++section)
+        {
+            Coefficients c;
+            const auto q = resonantSectionQ(numSections, section, resonance);
+            
+            if (highPass)
+                TylerAudio::TingeTape::BiquadDesign::makeHighPass(c.data(), sampleRate, cutoff, q);
+            else
+                TylerAudio::TingeTape::BiquadDesign::makeLowPass(c.data(), sampleRate, cutoff, q);
+            
+            magnitude *= std::abs((c[0] + c[1] * z + c[2] * z * z) / (1.0 + c[3] * z + c[4] * z * z));
+        }
+        
+        return juce::Decibels::gainToDecibels(magnitude, -200.0);
+    };
+    
+    SECTION("Each step adds 12 dB/oct with a Butterworth knee")
+    {
+        for (int numSections = 1; numSections <= TylerAudio::TingeTape::BiquadDesign::kMaxCascadeSections; ++numSections)
+        {
+            // A Butterworth filter of order 2n is 3 dB down at the cutoff and
+            // 10 log10(1 + 2^4n) dB down an octave past it
+            const double octaveDb = -10.0 * std::log10(1.0 + std::pow(2.0, 4.0 * numSections));
+            
+            INFO("Sections: " << numSections);
+            REQUIRE(cascadeMagnitudeDb(true, 100.0, 0.707, numSections, 100.0) == Approx(-3.01).margin(0.05));
+            REQUIRE(cascadeMagnitudeDb(true, 100.0, 0.707, numSections, 50.0) == Approx(octaveDb).margin(0.1));
+            REQUIRE(cascadeMagnitudeDb(false, 5000.0, 0.707, numSections, 5000.0) == Approx(-3.01).margin(0.05));
+            
+            // Resonance peaks the response at every slope
+            REQUIRE(cascadeMagnitudeDb(true, 100.0, 2.0, numSections, 100.0) > 6.0);
+        }
+    }
+    
+    SECTION("State-variable stages match the biquad cascade")
+    {
+        using Filter = TylerAudio::TingeTape::SIMDStateVariableFilter<float>;
+        
+        const int blockSize = 512;
+        const int numSamples = blockSize * 16;
+        const auto input = generateWhiteNoise(0.5f, numSamples, 2);
+        
+        for (int numSections = 2; numSections <= Filter::kMaxStages; ++numSections)
+        {
+            for (const auto type : {Filter::Type::highPass, Filter::Type::lowPass})
+            {
+                const float cutoff = type == Filter::Type::highPass ? 80.0f : 10000.0f;
+                const float resonance = 1.2f;
+                const std::vector<float> cutoffs(static_cast<size_t>(blockSize), cutoff);
+                const std::vector<float> resonances(static_cast<size_t>(blockSize), resonance);
+                
+                juce::AudioBuffer<float> output;
+                output.makeCopyOf(input);
+                
+                Filter filter;
+                filter.prepare(sampleRate, blockSize, 2, type);
+                filter.setNumStages(numSections);
+                
+                for (int position = 0; position < numSamples; position += blockSize)
+                {
+                    juce::dsp::AudioBlock<float> block(output.getArrayOfWritePointers(), 2,
+                                                       static_cast<size_t>(position), static_cast<size_t>(blockSize));
+                    filter.process(block, cutoffs.data(), resonances.data());
+                }
+                
+                std::vector<Coefficients> sections(static_cast<size_t>(numSections));
+                
+                for (int section = 0; section < numSections; ++section)
+                {
+                    const auto q = resonantSectionQ(numSections, section, static_cast<double>(resonance));
+                    auto* c = sections[static_cast<size_t>(section)].data();
+                    
+                    if (type == Filter::Type::highPass)
+                        TylerAudio::TingeTape::BiquadDesign::makeHighPass(c, sampleRate, static_cast<double>(cutoff), q);
+                    else
+                        TylerAudio::TingeTape::BiquadDesign::makeLowPass(c, sampleRate, static_cast<double>(cutoff), q);
+                }
+                
+                std::vector<std::array<double, 2>> state(static_cast<size_t>(numSections));
+                double maxError = 0.0;
+                
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    double y = static_cast<double>(input.getSample(0, i));
+                    
+                    for (size_t section = 0; section < sections.size(); ++section)
+                    {
+                        const auto& c = sections[section];
+                        const double x = y;
+                        y = c[0] * x + state[section][0];
+                        state[section][0] = c[1] * x - c[3] * y + state[section][1];
+                        state[section][1] = c[2] * x - c[4] * y;
+                    }
+                    
+                    maxError = std::max(maxError, std::abs(y - static_cast<double>(output.getSample(0, i))));
+                }
+                
+                INFO("Sections: " << numSections << ", cutoff: " << cutoff << "Hz, max error: " << maxError);
+                REQUIRE(maxError < 2.0e-3);
+            }
+        }
+    }
+    
+    SECTION("The processor follows the slope parameters")
+    {
+        const int blockSize = 512;
+        const int numSamples = 48000;
+        const auto input = generateTestTone(50.0f, 0.5f, sampleRate, numSamples, 2);
+        
+        // Level of a 50 Hz tone an octave below a 100 Hz low cut, relative to the input
+        auto measureAttenuationDb = [&](float slopeIndex, TylerAudio::TingeTape::CutFilterTopology topology)
+        {
+            TingeTapeAudioProcessor processor;
+            auto& parameters = processor.getParameters();
+            
+            for (const auto& [parameterID, value] : {std::pair{TylerAudio::ParameterIDs::kWow, 0.0f},
+                                                     std::pair{TylerAudio::ParameterIDs::kDirt, 0.0f},
+                                                     std::pair{TylerAudio::ParameterIDs::kLowCutFreq, 100.0f},
+                                                     std::pair{TylerAudio::ParameterIDs::kLowCutSlope, slopeIndex}})
+                if (auto* parameter = parameters.getParameter(parameterID))
+                    parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+            
+            processor.setCutFilterTopology(topology);
+            processor.prepareToPlay(sampleRate, blockSize);
+            
+            juce::AudioBuffer<float> buffer;
+            buffer.makeCopyOf(input);
+            juce::MidiBuffer midiBuffer;
+            
+            for (int position = 0; position < numSamples; position += blockSize)
+            {
+                juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), 2, position,
+                                               std::min(blockSize, numSamples - position));
+                processor.processBlock(block, midiBuffer);
+            }
+            
+            // Skip the first half while the filters settle
+            double inputPower = 0.0, outputPower = 0.0;
+            
+            for (int i = numSamples / 2; i < numSamples; ++i)
+            {
+                inputPower += static_cast<double>(input.getSample(0, i)) * static_cast<double>(input.getSample(0, i));
+                outputPower += static_cast<double>(buffer.getSample(0, i)) * static_cast<double>(buffer.getSample(0, i));
+            }
+            
+            return 10.0 * std::log10(outputPower / inputPower);
+        };
+        
+        for (const auto topology : {TylerAudio::TingeTape::CutFilterTopology::biquad,
+                                    TylerAudio::TingeTape::CutFilterTopology::stateVariable})
+        {
+            for (int slopeIndex = 0; slopeIndex < 4; ++slopeIndex)
+            {
+                const double expectedDb = -10.0 * std::log10(1.0 + std::pow(2.0, 4.0 * (slopeIndex + 1)));
+                
+                INFO("Slope: " << 12 * (slopeIndex + 1) << " dB/oct, topology: " << static_cast<int>(topology));
+                REQUIRE(measureAttenuationDb(static_cast<float>(slopeIndex), topology) == Approx(expectedDb).margin(1.0));
+            }
+        }
+    }
+    
+    SECTION("Slope changes mid-stream stay clean and lengthen the tail")
+    {
+        TingeTapeAudioProcessor processor;
+        auto* lowCutSlope = processor.getParameters().getParameter(TylerAudio::ParameterIDs::kLowCutSlope);
+        auto* highCutSlope = processor.getParameters().getParameter(TylerAudio::ParameterIDs::kHighCutSlope);
+        REQUIRE(lowCutSlope != nullptr);
+        REQUIRE(highCutSlope != nullptr);
+        
+        processor.prepareToPlay(sampleRate, 256);
+        const double gentleTail = processor.getTailLengthSeconds();
+        
+        juce::MidiBuffer midiBuffer;
+        
+        // Every combination in turn, so the cascade grows and shrinks from either side
+        for (int block = 0; block < 64; ++block)
+        {
+            lowCutSlope->setValueNotifyingHost(lowCutSlope->convertTo0to1(static_cast<float>(block % 4)));
+            highCutSlope->setValueNotifyingHost(highCutSlope->convertTo0to1(static_cast<float>((block / 4) % 4)));
+            
+            auto buffer = generateWhiteNoise(0.5f, 256, 2);
+            processor.processBlock(buffer, midiBuffer);
+            
+            REQUIRE_FALSE(hasInvalidValues(buffer));
+            REQUIRE(buffer.getMagnitude(0, 256) < 4.0f);
+        }
+        
+        lowCutSlope->setValueNotifyingHost(lowCutSlope->convertTo0to1(3.0f));
+        highCutSlope->setValueNotifyingHost(highCutSlope->convertTo0to1(3.0f));
+        REQUIRE(processor.getTailLengthSeconds() > gentleTail);
+    }
+}
+
 TEST_CASE("TingeTape Unit Tests - Parameter Smoothing", "[TingeTape][unit][parameters]")
 {
     SECTION("Wow parameter 50ms smoothing validation")
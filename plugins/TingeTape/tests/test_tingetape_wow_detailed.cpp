@@ -6,6 +6,7 @@
 #include <chrono>
 #include <vector>
 #include <complex>
+#include <algorithm>
 
 using namespace TylerAudio::Testing;
 using Catch::Approx;
@@ -345,4 +346,272 @@ TEST_CASE("WowEngine Algorithm Correction Tests", "[TingeTape][unit][wow][detail
         REQUIRE_FALSE(hasInvalidValues(buffer));
         // Detailed formula verification will be added in implementation phase
     }
-}
\ No newline at end of file
+}
+TEST_CASE("WowEngine LFO rate is independent of channel count", "[TingeTape][unit][wow][detailed]")
+{
+    // A ramp through the delay comes out as n - delay(n), so the modulated delay can be
+    // read back exactly from any channel
+    const double sampleRate = 48000.0;
+    const int blockSize = 480;
+    const int numBlocks = 1000;  // 10 seconds, five wow cycles
+
+    for (const int numChannels : {1, 2, 6, 16})
+    {
+        TylerAudio::TingeTape::WowEngine<double> wowEngine;
+        wowEngine.prepare(sampleRate, blockSize, numChannels);
+
+        const std::vector<float> depth(static_cast<size_t>(blockSize), 30.0f);
+        const std::vector<float> off(static_cast<size_t>(blockSize), 0.0f);
+        juce::AudioBuffer<double> buffer(numChannels, blockSize);
+        std::vector<double> delaySamples;
+        delaySamples.reserve(static_cast<size_t>(blockSize * numBlocks));
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            const int position = block * blockSize;
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                for (int i = 0; i < blockSize; ++i)
+                    buffer.setSample(ch, i, static_cast<double>(position + i));
+
+            juce::dsp::AudioBlock<double> audioBlock(buffer);
+            wowEngine.process(audioBlock, depth.data(), off.data(), off.data());
+
+            for (int i = 0; i < blockSize; ++i)
+                delaySamples.push_back(static_cast<double>(position + i) - buffer.getSample(numChannels - 1, i));
+        }
+
+        // Skip the first 100 ms while the delay line fills, then time the upward crossings
+        // of the mid-point between the smallest and largest delay
+        const size_t start = static_cast<size_t>(sampleRate * 0.1);
+        const auto [minDelay, maxDelay] = std::minmax_element(delaySamples.begin() + static_cast<std::ptrdiff_t>(start),
+                                                              delaySamples.end());
+        const double midPoint = (*minDelay + *maxDelay) * 0.5;
+        std::vector<double> crossings;
+
+        for (size_t i = start + 1; i < delaySamples.size(); ++i)
+            if (delaySamples[i - 1] < midPoint && delaySamples[i] >= midPoint)
+                crossings.push_back(static_cast<double>(i));
+
+        REQUIRE(crossings.size() >= 4);
+
+        const double periodSeconds = (crossings.back() - crossings.front())
+                                   / static_cast<double>(crossings.size() - 1) / sampleRate;
+
+        INFO(numChannels << " channels: wow period " << periodSeconds << " s");
+        REQUIRE(periodSeconds == Approx(2.0).epsilon(0.001));  // 0.5 Hz
+    }
+}
+
+TEST_CASE("TransportModulation bank", "[TingeTape][unit][wow][detailed]")
+{
+    using TylerAudio::TingeTape::TransportModulation;
+
+    const double sampleRate = 48000.0;
+    const int blockSize = 480;
+    const int numSamples = static_cast<int>(sampleRate) * 10;
+
+    // Renders ten seconds of delay offset in ms with constant depths
+    auto render = [&](float wow, float flutter, float drift)
+    {
+        TransportModulation bank;
+        bank.prepare(sampleRate);
+        bank.setControlInterval(16);
+
+        const std::vector<float> wowDepth(static_cast<size_t>(blockSize), wow);
+        const std::vector<float> flutterDepth(static_cast<size_t>(blockSize), flutter);
+        const std::vector<float> driftDepth(static_cast<size_t>(blockSize), drift);
+        std::vector<float> offset(static_cast<size_t>(numSamples));
+
+        for (int position = 0; position < numSamples; position += blockSize)
+            bank.render(offset.data() + position, wowDepth.data(), flutterDepth.data(), driftDepth.data(), blockSize);
+
+        return offset;
+    };
+
+    // Amplitude of one frequency component, exact for a whole number of cycles
+    auto amplitudeAt = [&](const std::vector<float>& signal, double frequency)
+    {
+        std::complex<double> sum;
+
+        for (size_t i = 0; i < signal.size(); ++i)
+            sum += static_cast<double>(signal[i])
+                 * std::polar(1.0, -juce::MathConstants<double>::twoPi * frequency * static_cast<double>(i) / sampleRate);
+
+        return 2.0 * std::abs(sum) / static_cast<double>(signal.size());
+    };
+
+    SECTION("Zero depth gives no modulation")
+    {
+        const auto offset = render(0.0f, 0.0f, 0.0f);
+        REQUIRE(std::all_of(offset.begin(), offset.end(), [](float value) { return value == 0.0f; }));
+    }
+
+    SECTION("Each component stays within its range at full depth")
+    {
+        const auto peak = [](const std::vector<float>& signal)
+        {
+            return std::abs(*std::max_element(signal.begin(), signal.end(),
+                                              [](float a, float b) { return std::abs(a) < std::abs(b); }));
+        };
+
+        const auto wow = render(100.0f, 0.0f, 0.0f);
+        const auto flutter = render(0.0f, 100.0f, 0.0f);
+        const auto drift = render(0.0f, 0.0f, 100.0f);
+
+        REQUIRE(peak(wow) == Approx(TransportModulation::kWowRangeMs).epsilon(0.001));
+        REQUIRE(peak(flutter) <= TransportModulation::kFlutterRangeMs * 1.001f);
+        REQUIRE(peak(flutter) > TransportModulation::kFlutterRangeMs * 0.5f);
+        REQUIRE(peak(drift) <= TransportModulation::kDriftRangeMs * 1.001f);
+        REQUIRE(peak(drift) > TransportModulation::kDriftRangeMs * 0.1f);
+    }
+
+    SECTION("Flutter is made of the capstan and pinch roller partials")
+    {
+        const auto flutter = render(0.0f, 100.0f, 0.0f);
+        const double range = TransportModulation::kFlutterRangeMs;
+
+        REQUIRE(amplitudeAt(flutter, 6.2) == Approx(0.6 * range).epsilon(0.01));
+        REQUIRE(amplitudeAt(flutter, 12.4) == Approx(0.25 * range).epsilon(0.01));
+        REQUIRE(amplitudeAt(flutter, 17.7) == Approx(0.15 * range).epsilon(0.01));
+        REQUIRE(amplitudeAt(flutter, 0.5) < 0.001 * range);
+    }
+
+    SECTION("Drift wanders slowly and repeats after a reset")
+    {
+        const auto drift = render(0.0f, 0.0f, 100.0f);
+
+        // Band-limited: well below the flutter partials, and smooth sample to sample
+        REQUIRE(amplitudeAt(drift, 6.2) < 0.01 * TransportModulation::kDriftRangeMs);
+
+        float maxStep = 0.0f;
+        for (size_t i = 1; i < drift.size(); ++i)
+            maxStep = std::max(maxStep, std::abs(drift[i] - drift[i - 1]));
+
+        REQUIRE(maxStep < TransportModulation::kDriftRangeMs * 1.0e-3f);
+        REQUIRE(render(0.0f, 0.0f, 100.0f) == drift);
+    }
+}
+
+TEST_CASE("ModulatedDelay interpolation", "[TingeTape][unit][wow][detailed]")
+{
+    using TylerAudio::TingeTape::DelayInterpolation;
+    using TylerAudio::TingeTape::ModulatedDelay;
+
+    const double sampleRate = 48000.0;
+    const int blockSize = 256;
+    const int maxDelay = 2400;
+
+    SECTION("Linear interpolation matches juce::dsp::DelayLine")
+    {
+        const int numChannels = 2;
+        ModulatedDelay<float> delay;
+        delay.prepare(maxDelay, blockSize, numChannels);
+
+        juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> reference(maxDelay + 1);
+        reference.prepare({sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels)});
+
+        const auto noise = generateWhiteNoise(0.5f, blockSize * 200, numChannels);
+        juce::AudioBuffer<float> output(numChannels, blockSize);
+        std::vector<float> delayCurve(static_cast<size_t>(blockSize));
+        float maxDifference = 0.0f;
+
+        for (int position = 0; position + blockSize <= noise.getNumSamples(); position += blockSize)
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                const double phase = juce::MathConstants<double>::twoPi * 0.5 * (position + i) / sampleRate;
+                delayCurve[static_cast<size_t>(i)] = static_cast<float>(1.0 + 1000.0 * (1.0 + std::sin(phase)));
+            }
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                output.copyFrom(ch, 0, noise, ch, position, blockSize);
+
+            juce::dsp::AudioBlock<float> block(output);
+            delay.process(block, delayCurve.data());
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    reference.pushSample(ch, noise.getSample(ch, position + i));
+                    const float expected = reference.popSample(ch, delayCurve[static_cast<size_t>(i)]);
+                    maxDifference = juce::jmax(maxDifference, std::abs(output.getSample(ch, i) - expected));
+                }
+            }
+        }
+
+        REQUIRE(maxDifference < 1.0e-6f);
+    }
+
+    SECTION("Polynomial interpolators reproduce a modulated ramp exactly")
+    {
+        // Linear, cubic and Lagrange interpolation are all exact on a straight line
+        for (const auto interpolation : {DelayInterpolation::linear, DelayInterpolation::cubicHermite,
+                                         DelayInterpolation::lagrange3rd})
+        {
+            ModulatedDelay<double> delay;
+            delay.prepare(maxDelay, blockSize, 1);
+            delay.setInterpolation(interpolation);
+
+            juce::AudioBuffer<double> buffer(1, blockSize);
+            std::vector<float> delayCurve(static_cast<size_t>(blockSize));
+            double maxError = 0.0;
+
+            for (int position = 0; position < blockSize * 100; position += blockSize)
+            {
+                for (int i = 0; i < blockSize; ++i)
+                {
+                    delayCurve[static_cast<size_t>(i)] = static_cast<float>(1.0 + 500.0 * (1.0 + std::sin(0.001 * (position + i))));
+                    buffer.setSample(0, i, static_cast<double>(position + i));
+                }
+
+                juce::dsp::AudioBlock<double> block(buffer);
+                delay.process(block, delayCurve.data());
+
+                // Once the history holds the longest delay, output is the ramp shifted back
+                if (position >= maxDelay + blockSize)
+                    for (int i = 0; i < blockSize; ++i)
+                        maxError = std::max(maxError, std::abs(buffer.getSample(0, i) - (position + i - static_cast<double>(delayCurve[static_cast<size_t>(i)]))));
+            }
+
+            INFO("Interpolation " << static_cast<int>(interpolation));
+            REQUIRE(maxError < 1.0e-9);
+        }
+    }
+
+    SECTION("Every interpolator delays a low sine by a fractional amount")
+    {
+        const double fractionalDelay = 10.3;
+        const double omega = juce::MathConstants<double>::twoPi * 100.0 / sampleRate;
+
+        for (const auto interpolation : {DelayInterpolation::linear, DelayInterpolation::cubicHermite,
+                                         DelayInterpolation::lagrange3rd, DelayInterpolation::allpass})
+        {
+            ModulatedDelay<double> delay;
+            delay.prepare(maxDelay, blockSize, 1);
+            delay.setInterpolation(interpolation);
+
+            juce::AudioBuffer<double> buffer(1, blockSize);
+            const std::vector<float> delayCurve(static_cast<size_t>(blockSize), static_cast<float>(fractionalDelay));
+            double maxError = 0.0;
+
+            for (int position = 0; position < blockSize * 100; position += blockSize)
+            {
+                for (int i = 0; i < blockSize; ++i)
+                    buffer.setSample(0, i, std::sin(omega * (position + i)));
+
+                juce::dsp::AudioBlock<double> block(buffer);
+                delay.process(block, delayCurve.data());
+
+                // Skip the start-up while the allpass settles
+                if (position >= blockSize * 10)
+                    for (int i = 0; i < blockSize; ++i)
+                        maxError = std::max(maxError, std::abs(buffer.getSample(0, i) - std::sin(omega * (position + i - fractionalDelay))));
+            }
+
+            INFO("Interpolation " << static_cast<int>(interpolation));
+            REQUIRE(maxError < 1.0e-4);
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 
@@ -35,25 +37,115 @@ namespace TylerAudio
             return (std::abs(value) < Constants::kDenormalThreshold) ? 0.0f : value;
         }
         
-        // Thread-safe parameter smoothing
+        // Thread-safe parameter smoothing. The value approaches the target exponentially and
+        // lands on it once within a millionth of it, or once a step no longer moves it in
+        // float, so a settled smoother holds the target exactly.
         class SmoothingFilter
         {
         public:
+            SmoothingFilter() noexcept
+            {
+                updateBlockDecay();
+            }
+            
             void setTargetValue(float newValue) noexcept
             {
                 targetValue.store(newValue, std::memory_order_relaxed);
             }
             
             [[nodiscard]] float getNextValue() noexcept
+            {
+                return advance(smoothingCoeff);
+            }
+            
+            // Control-rate smoothing: each call advances the smoother by the control
+            // interval set below in a single step, following the same exponential curve
+            [[nodiscard]] float getNextControlValue() noexcept
+            {
+                return advance(controlCoeff);
+            }
+            
+            // Writes the next numSamples values, as that many getNextValue() calls would, with
+            // the target read once. Returns false if the smoother had already settled, in which
+            // case every value written is the target and callers can treat it as a constant.
+            bool fillBlock(float* destination, int numSamples) noexcept
             {
                 const float target = targetValue.load(std::memory_order_relaxed);
-                currentValue += (target - currentValue) * smoothingCoeff;
-                return sanitizeFloat(currentValue);
+                
+                if (currentValue == target)
+                {
+                    std::fill(destination, destination + std::max(0, numSamples), sanitizeFloat(target));
+                    return false;
+                }
+                
+                // Sample n of the ramp is target + distance * r^(n + 1). Taking kBlockLanes
+                // samples at a time from a table of powers of r leaves the inner loop with no
+                // dependency between samples, so it vectorises.
+                const auto total = static_cast<size_t>(std::max(0, numSamples));
+                float distance = currentValue - target;
+                size_t i = 0;
+                
+                for (; i + kBlockLanes <= total; i += kBlockLanes)
+                {
+                    for (size_t lane = 0; lane < kBlockLanes; ++lane)
+                        destination[i + lane] = sanitizeFloat(target + distance * blockDecay[lane]);
+                    
+                    distance *= blockDecay[kBlockLanes - 1];
+                }
+                
+                const auto remaining = total - i;
+                
+                for (size_t lane = 0; lane < remaining; ++lane)
+                    destination[i + lane] = sanitizeFloat(target + distance * blockDecay[lane]);
+                
+                if (remaining > 0)
+                    distance *= blockDecay[remaining - 1];
+                
+                currentValue = target + distance;
+                snapToTargetIfClose(target);
+                return true;
+            }
+            
+            // Advances the smoother numSamples samples without rendering them
+            void skip(int numSamples) noexcept
+            {
+                const float target = targetValue.load(std::memory_order_relaxed);
+                
+                if (currentValue == target || numSamples <= 0)
+                    return;
+                
+                const auto decay = std::pow(1.0 - static_cast<double>(smoothingCoeff), numSamples);
+                currentValue = target + (currentValue - target) * static_cast<float>(decay);
+                snapToTargetIfClose(target);
+            }
+            
+            [[nodiscard]] float getCurrentValue() const noexcept
+            {
+                return currentValue;
+            }
+            
+            [[nodiscard]] float getTargetValue() const noexcept
+            {
+                return targetValue.load(std::memory_order_relaxed);
+            }
+            
+            // True once the smoothed value is within tolerance (in parameter units) of the target
+            [[nodiscard]] bool isSettled(float tolerance = 1.0e-3f) const noexcept
+            {
+                return std::abs(targetValue.load(std::memory_order_relaxed) - currentValue) <= tolerance;
             }
             
             void setSmoothingTime(double smoothingTimeSeconds, double sampleRate) noexcept
             {
                 smoothingCoeff = static_cast<float>(1.0 - std::exp(-1.0 / (smoothingTimeSeconds * sampleRate)));
+                updateControlCoeff();
+                updateBlockDecay();
+            }
+            
+            void setControlInterval(int numSamples) noexcept
+            {
+                controlInterval = std::max(1, numSamples);
+                updateControlCoeff();
             }
             
             void snapToTarget() noexcept
@@ -62,9 +154,45 @@ namespace TylerAudio
             }
             
         private:
+            static constexpr size_t kBlockLanes = 8;
+            static constexpr float kSnapTolerance = 1.0e-6f;  // Relative to the target, or absolute below 1
+            
+            float advance(float coeff) noexcept
+            {
+                const float target = targetValue.load(std::memory_order_relaxed);
+                const float nextValue = currentValue + (target - currentValue) * coeff;
+                
+                // Far from zero the step rounds away before the relative tolerance is reached
+                currentValue = nextValue == currentValue ? target : nextValue;
+                snapToTargetIfClose(target);
+                return sanitizeFloat(currentValue);
+            }
+            
+            void snapToTargetIfClose(float target) noexcept
+            {
+                if (std::abs(target - currentValue) <= kSnapTolerance * std::max(1.0f, std::abs(target)))
+                    currentValue = target;
+            }
+            
+            void updateControlCoeff() noexcept
+            {
+                // N per-sample steps of c leave (1 - c)^N of the distance to the target
+                controlCoeff = static_cast<float>(1.0 - std::pow(1.0 - static_cast<double>(smoothingCoeff), controlInterval));
+            }
+            
+            void updateBlockDecay() noexcept
+            {
+                // blockDecay[n] = (1 - c)^(n + 1)
+                for (size_t lane = 0; lane < kBlockLanes; ++lane)
+                    blockDecay[lane] = static_cast<float>(std::pow(1.0 - static_cast<double>(smoothingCoeff), static_cast<double>(lane + 1)));
+            }
+            
             std::atomic<float> targetValue{0.0f};
             float currentValue{0.0f};
             float smoothingCoeff{0.01f};
+            float controlCoeff{0.01f};
+            int controlInterval{1};
+            std::array<float, kBlockLanes> blockDecay{};
         };
         
         // Realtime-safe parameter access helper
@@ -114,10 +242,14 @@ namespace TylerAudio
         
         // TingeTape specific parameters
         constexpr char kWow[] = "wow";
+        constexpr char kFlutter[] = "flutter";
+        constexpr char kDrift[] = "drift";
         constexpr char kLowCutFreq[] = "lowCutFreq";
         constexpr char kLowCutRes[] = "lowCutRes";
         constexpr char kHighCutFreq[] = "highCutFreq";
         constexpr char kHighCutRes[] = "highCutRes";
+        constexpr char kLowCutSlope[] = "lowCutSlope";
+        constexpr char kHighCutSlope[] = "highCutSlope";
         constexpr char kDirt[] = "dirt";
         constexpr char kTone[] = "tone";
     }
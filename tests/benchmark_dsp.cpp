@@ -33,6 +33,47 @@ TEST_CASE("DSP utility function benchmarks", "[benchmark][dsp]")
     };
 }
 
+TEST_CASE("Parameter smoothing benchmarks", "[benchmark][dsp]")
+{
+    const int bufferSize = 512;
+    std::vector<float> values(static_cast<size_t>(bufferSize));
+    
+    Utils::SmoothingFilter smoother;
+    smoother.setSmoothingTime(0.05, 48000.0);
+    
+    // Each run starts a fresh ramp so the smoother never settles mid-benchmark
+    auto restartRamp = [&smoother]
+    {
+        smoother.setTargetValue(0.0f);
+        smoother.snapToTarget();
+        smoother.setTargetValue(1.0f);
+    };
+    
+    BENCHMARK("Per-sample getNextValue ramp")
+    {
+        restartRamp();
+        
+        for (auto& value : values)
+            value = smoother.getNextValue();
+        
+        return values.back();
+    };
+    
+    BENCHMARK("fillBlock ramp")
+    {
+        restartRamp();
+        smoother.fillBlock(values.data(), bufferSize);
+        return values.back();
+    };
+    
+    BENCHMARK("fillBlock settled")
+    {
+        smoother.setTargetValue(0.5f);
+        smoother.snapToTarget();
+        return smoother.fillBlock(values.data(), bufferSize) ? values.back() : values.front();
+    };
+}
+
 TEST_CASE("Audio buffer processing benchmarks", "[benchmark][audio]")
 {
     const int sampleRate = 48000;
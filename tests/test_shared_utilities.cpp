@@ -47,6 +47,104 @@ TEST_CASE("TylerAudio::Utils dB conversion functions are accurate", "[utils][dsp
     }
 }
 
+TEST_CASE("TylerAudio::Utils::SmoothingFilter block rendering matches per-sample smoothing", "[utils][dsp]")
+{
+    constexpr double sampleRate = 48000.0;
+    
+    Utils::SmoothingFilter perSample;
+    Utils::SmoothingFilter block;
+    
+    for (auto* smoother : { &perSample, &block })
+    {
+        smoother->setSmoothingTime(0.01, sampleRate);
+        smoother->setTargetValue(1.0f);
+        smoother->snapToTarget();
+        smoother->setTargetValue(0.25f);
+    }
+    
+    SECTION("Ramps follow getNextValue() across block sizes and tails")
+    {
+        std::vector<float> values(333);
+        
+        for (int blockSize : { 1, 7, 8, 64, 333 })
+        {
+            REQUIRE(block.fillBlock(values.data(), blockSize));
+            
+            for (int i = 0; i < blockSize; ++i)
+                REQUIRE(values[static_cast<size_t>(i)] == Catch::Approx(perSample.getNextValue()).margin(1e-5f));
+            
+            REQUIRE(block.getCurrentValue() == Catch::Approx(perSample.getCurrentValue()).margin(1e-5f));
+        }
+    }
+    
+    SECTION("Skipping lands where the rendered ramp would")
+    {
+        std::vector<float> values(100);
+        block.fillBlock(values.data(), 100);
+        perSample.skip(100);
+        
+        REQUIRE(perSample.getCurrentValue() == Catch::Approx(block.getCurrentValue()).margin(1e-6f));
+    }
+    
+    SECTION("A settled smoother holds the target exactly and reports a constant block")
+    {
+        std::vector<float> values(512);
+        
+        // Ten time constants and more: close enough to snap onto the target
+        for (int i = 0; i < 20; ++i)
+            block.fillBlock(values.data(), 512);
+        
+        REQUIRE(block.getCurrentValue() == 0.25f);
+        REQUIRE_FALSE(block.fillBlock(values.data(), 512));
+        
+        for (float value : values)
+            REQUIRE(value == 0.25f);
+        
+        // A new target starts a ramp again
+        block.setTargetValue(0.5f);
+        REQUIRE(block.fillBlock(values.data(), 512));
+        REQUIRE(values.front() > 0.25f);
+        REQUIRE(values.back() < 0.5f);
+    }
+}
+
+TEST_CASE("TylerAudio::Utils::SmoothingFilter lands exactly on large targets", "[utils][dsp]")
+{
+    // Far above 1 a float step stops moving the value before it is within a millionth of
+    // the target, so the smoother has to land on it once the step rounds away
+    constexpr double sampleRate = 48000.0;
+    
+    for (float target : { 25.0f, 100.0f, 15000.0f })
+    {
+        INFO("Target: " << target);
+        
+        Utils::SmoothingFilter perSample;
+        Utils::SmoothingFilter controlRate;
+        
+        for (auto* smoother : { &perSample, &controlRate })
+        {
+            smoother->setSmoothingTime(0.03, sampleRate);
+            smoother->setControlInterval(16);
+            smoother->setTargetValue(target * 0.5f);
+            smoother->snapToTarget();
+            smoother->setTargetValue(target);
+        }
+        
+        // Five seconds: far past where either would stall short of the target
+        for (int i = 0; i < static_cast<int>(sampleRate) * 5; ++i)
+            (void) perSample.getNextValue();
+        
+        for (int i = 0; i < static_cast<int>(sampleRate) * 5 / 16; ++i)
+            (void) controlRate.getNextControlValue();
+        
+        REQUIRE(perSample.getCurrentValue() == target);
+        REQUIRE(controlRate.getCurrentValue() == target);
+        
+        std::vector<float> values(64);
+        REQUIRE_FALSE(perSample.fillBlock(values.data(), 64));
+    }
+}
+
 TEST_CASE("TylerAudio::Constants have reasonable values", "[constants]")
 {
     REQUIRE(Constants::defaultWidth > 0);